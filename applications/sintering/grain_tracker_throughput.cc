@@ -21,6 +21,8 @@
 
 #include <pf-applications/lac/dynamic_block_vector.h>
 
+#include <pf-applications/numerics/vector_tools.h>
+
 #include <pf-applications/sintering/initial_values_cloud.h>
 #include <pf-applications/sintering/initial_values_hypercube.h>
 #include <pf-applications/sintering/particle.h>
@@ -272,16 +274,22 @@ public:
   void
   set_initial_conditions(const InitialValues<dim> &initial_values)
   {
+    // The first n_skip components are not stored
+    std::vector<BlockVectorType::BlockType *> component_ptr(
+      initial_values.n_components(), nullptr);
+
     for (unsigned int b = 0; b < solution.n_blocks(); ++b)
       if (b + n_skip < initial_values.n_components())
-        {
-          initial_values.set_component(b + n_skip);
+        component_ptr[b + n_skip] = &solution.block(b);
 
-          VectorTools::interpolate(mapping,
-                                   dof_handler,
-                                   initial_values,
-                                   solution.block(b));
+    VectorTools::interpolate_components(mapping,
+                                        dof_handler,
+                                        initial_values,
+                                        component_ptr);
 
+    for (unsigned int b = 0; b < solution.n_blocks(); ++b)
+      if (b + n_skip < initial_values.n_components())
+        {
           constraints.distribute(solution.block(b));
 
           if (solution.block(b).has_ghost_elements())
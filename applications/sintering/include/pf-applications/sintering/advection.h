@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/point.h>
 
 #include <deal.II/distributed/tria.h>
@@ -8,6 +9,9 @@
 
 #include <pf-applications/grain_tracker/tracker.h>
 
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
+
 namespace Sintering
 {
   using namespace dealii;
@@ -181,12 +185,13 @@ namespace Sintering
 
           for (unsigned int i = 0; i < n_indices; ++i)
             {
-              const auto index = index_values[index_ptr[cell] + i];
+              const auto slot = index_slots[index_ptr[cell] + i];
 
-              if (index != numbers::invalid_unsigned_int)
-                current_cell_data[i / n_lanes].fill(i % n_lanes,
-                                                    grain_center(index),
-                                                    grain_data(index));
+              if (slot != numbers::invalid_unsigned_int)
+                current_cell_data[i / n_lanes].fill(
+                  i % n_lanes,
+                  &grains_center[dim * slot],
+                  &grains_data[n_comp_volume_force_torque * slot]);
               else
                 current_cell_data[i / n_lanes].nullify(i % n_lanes);
             }
@@ -232,49 +237,145 @@ namespace Sintering
     {
       this->index_ptr    = index_ptr;
       this->index_values = index_values;
+
+      // translate the segment indices into the slots of the local storage
+      index_slots.resize(index_values.size());
+      for (unsigned int i = 0; i < index_values.size(); ++i)
+        index_slots[i] = (index_values[i] != numbers::invalid_unsigned_int) ?
+                           segment_slot(index_values[i]) :
+                           numbers::invalid_unsigned_int;
     }
 
+    /* Only the segments touched by this process and the segments it owns
+     * are stored. A slot is created the first time a segment is accessed.
+     */
     void
     nullify_data(const unsigned int n_segments)
     {
-      grains_data.assign(n_comp_volume_force_torque * n_segments, 0);
-      grains_center.assign(dim * n_segments, 0);
+      this->n_segments = n_segments;
+
+      segment_slots.clear();
+      grains_data.clear();
+      grains_center.clear();
+    }
+
+    /* Sum up the contributions of all processes to the segments referenced
+     * in the grain table. Each segment is owned by a process, which collects
+     * the contributions and sends the sums back only to the processes that
+     * touch the segment. After the call, a process has the complete data of
+     * the segments it touches and of the segments it owns.
+     */
+    void
+    reduce_grains_data(const MPI_Comm comm)
+    {
+      const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+      const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+
+      if (n_procs == 1)
+        return;
+
+      std::vector<unsigned int> touched_segments;
+      for (const auto index : index_values)
+        if (index != numbers::invalid_unsigned_int)
+          touched_segments.push_back(index);
+
+      std::sort(touched_segments.begin(), touched_segments.end());
+      touched_segments.erase(std::unique(touched_segments.begin(),
+                                         touched_segments.end()),
+                             touched_segments.end());
+
+      using SegmentsData =
+        std::pair<std::vector<unsigned int>, std::vector<Number>>;
+
+      // 1) send the contributions to the owners of the segments
+      std::map<unsigned int, SegmentsData> contributions;
+
+      for (const auto index : touched_segments)
+        {
+          const unsigned int owner = segment_owner(index, n_procs);
+
+          if (owner == my_rank)
+            continue;
+
+          auto &data = contributions[owner];
+          data.first.push_back(index);
+          data.second.insert(data.second.end(),
+                             grain_data(index),
+                             grain_data(index) + n_comp_volume_force_torque);
+        }
+
+      const auto received_contributions =
+        Utilities::MPI::some_to_some(comm, contributions);
+
+      // 2) sum up the contributions to the owned segments, which might not
+      // be touched by this process
+      for (const auto &[rank, data] : received_contributions)
+        {
+          (void)rank;
+
+          for (unsigned int i = 0; i < data.first.size(); ++i)
+            for (unsigned int c = 0; c < n_comp_volume_force_torque; ++c)
+              grain_data(data.first[i])[c] +=
+                data.second[i * n_comp_volume_force_torque + c];
+        }
+
+      // 3) send the sums back to the processes touching the segments
+      std::map<unsigned int, std::vector<Number>> sums;
+
+      for (const auto &[rank, data] : received_contributions)
+        {
+          auto &values = sums[rank];
+
+          for (const auto index : data.first)
+            values.insert(values.end(),
+                          grain_data(index),
+                          grain_data(index) + n_comp_volume_force_torque);
+        }
+
+      const auto received_sums = Utilities::MPI::some_to_some(comm, sums);
+
+      for (const auto &[rank, values] : received_sums)
+        {
+          const auto &indices = contributions.at(rank).first;
+
+          AssertDimension(values.size(),
+                          indices.size() * n_comp_volume_force_torque);
+
+          for (unsigned int i = 0; i < indices.size(); ++i)
+            std::copy_n(values.begin() + i * n_comp_volume_force_torque,
+                        n_comp_volume_force_torque,
+                        grain_data(indices[i]));
+        }
     }
 
     Number *
     grain_data(const unsigned int index)
     {
-      return &grains_data[n_comp_volume_force_torque * index];
+      return &grains_data[n_comp_volume_force_torque * segment_slot(index)];
     }
 
     const Number *
     grain_data(const unsigned int index) const
     {
-      return &grains_data[n_comp_volume_force_torque * index];
+      return &grains_data[n_comp_volume_force_torque * segment_slot(index)];
     }
 
     Number *
     grain_center(const unsigned int index)
     {
-      return &grains_center[dim * index];
+      return &grains_center[dim * segment_slot(index)];
     }
 
     const Number *
     grain_center(const unsigned int index) const
     {
-      return &grains_center[dim * index];
+      return &grains_center[dim * segment_slot(index)];
     }
 
-    std::vector<Number> &
-    get_grains_data()
+    unsigned int
+    n_stored_segments() const
     {
-      return grains_data;
-    }
-
-    const std::vector<Number> &
-    get_grains_data() const
-    {
-      return grains_data;
+      return segment_slots.size();
     }
 
     bool
@@ -286,8 +387,43 @@ namespace Sintering
     template <typename Stream>
     void
     print_forces(Stream &                                  out,
-                 const GrainTracker::Tracker<dim, Number> &grain_tracker) const
+                 const GrainTracker::Tracker<dim, Number> &grain_tracker,
+                 const MPI_Comm comm = MPI_COMM_WORLD) const
     {
+      // Only the owners have the complete data of the segments, they send
+      // it to the root process, which is the only one printing
+      const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+      const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+
+      std::pair<std::vector<unsigned int>, std::vector<Number>> owned_data;
+
+      for (const auto &[index, slot] : segment_slots)
+        if (segment_owner(index, n_procs) == my_rank)
+          {
+            owned_data.first.push_back(index);
+            owned_data.second.insert(
+              owned_data.second.end(),
+              grains_data.begin() + slot * n_comp_volume_force_torque,
+              grains_data.begin() + (slot + 1) * n_comp_volume_force_torque);
+          }
+
+      const auto all_owned_data = Utilities::MPI::gather(comm, owned_data, 0);
+
+      if (my_rank != 0)
+        return;
+
+      // Segments without any contribution have zero volume, force and torque
+      std::vector<Number> all_grains_data(n_comp_volume_force_torque *
+                                            n_segments,
+                                          0);
+
+      for (const auto &[indices, values] : all_owned_data)
+        for (unsigned int i = 0; i < indices.size(); ++i)
+          std::copy_n(values.begin() + i * n_comp_volume_force_torque,
+                      n_comp_volume_force_torque,
+                      all_grains_data.begin() +
+                        indices[i] * n_comp_volume_force_torque);
+
       out << std::endl;
       out << "Grains segments volumes, forces and torques:" << std::endl;
 
@@ -297,8 +433,10 @@ namespace Sintering
                segment_id < grain.get_segments().size();
                segment_id++)
             {
-              const Number *data = grain_data(
-                grain_tracker.get_grain_segment_index(grain_id, segment_id));
+              const Number *data =
+                all_grains_data.data() +
+                n_comp_volume_force_torque *
+                  grain_tracker.get_grain_segment_index(grain_id, segment_id);
 
               Number                 volume(*data++);
               Tensor<1, dim, Number> force(make_array_view(data, data + dim));
@@ -317,6 +455,42 @@ namespace Sintering
     }
 
   private:
+    unsigned int
+    segment_owner(const unsigned int index, const unsigned int n_procs) const
+    {
+      return static_cast<std::uint64_t>(index) * n_procs / n_segments;
+    }
+
+    unsigned int
+    segment_slot(const unsigned int index)
+    {
+      AssertIndexRange(index, n_segments);
+
+      const auto [it, inserted] =
+        segment_slots.try_emplace(index, segment_slots.size());
+
+      if (inserted)
+        {
+          grains_data.resize(grains_data.size() + n_comp_volume_force_torque,
+                             0);
+          grains_center.resize(grains_center.size() + dim, 0);
+        }
+
+      return it->second;
+    }
+
+    unsigned int
+    segment_slot(const unsigned int index) const
+    {
+      const auto it = segment_slots.find(index);
+
+      AssertThrow(it != segment_slots.end(),
+                  ExcMessage("Segment " + std::to_string(index) +
+                             " is neither touched nor owned by this process"));
+
+      return it->second;
+    }
+
     const bool   is_active;
     const double mt;
     const double mr;
@@ -328,8 +502,11 @@ namespace Sintering
 
     std::vector<unsigned int> index_ptr;
     std::vector<unsigned int> index_values;
+    std::vector<unsigned int> index_slots;
 
-    std::vector<Number> grains_data;
-    std::vector<Number> grains_center;
+    unsigned int                         n_segments = 0;
+    std::map<unsigned int, unsigned int> segment_slots;
+    std::vector<Number>                  grains_data;
+    std::vector<Number>                  grains_center;
   };
 } // namespace Sintering
\ No newline at end of file
@@ -109,6 +109,14 @@ namespace Sintering
 #  error "Option OPERATOR has to be specified"
 #endif
 
+    // Types of the single-precision Jacobian (mixed-precision mode)
+    using NumberMixed              = float;
+    using VectorizedArrayTypeMixed = VectorizedArray<NumberMixed>;
+    using VectorTypeMixed =
+      LinearAlgebra::distributed::DynamicBlockVector<NumberMixed>;
+    using NonLinearOperatorMixed =
+      SinteringOperatorGeneric<dim, NumberMixed, VectorizedArrayTypeMixed>;
+
     const Parameters                          params;
     ConditionalOStream                        pcout;
     ConditionalOStream                        pcout_statistics;
@@ -120,10 +128,17 @@ namespace Sintering
 
     std::unique_ptr<dealii::parallel::Helper<dim>> helper;
 
+    // number of active order parameters of each locally owned cell
+    std::vector<unsigned int> cell_n_active_grains;
+
     AffineConstraints<Number> constraints;
 
     MatrixFree<dim, Number, VectorizedArrayType> matrix_free;
 
+    // mixed precision
+    AffineConstraints<NumberMixed>                         constraints_mixed;
+    MatrixFree<dim, NumberMixed, VectorizedArrayTypeMixed> matrix_free_mixed;
+
     // multigrid
     std::vector<std::shared_ptr<const Triangulation<dim>>> mg_triangulations;
 
@@ -225,6 +240,12 @@ namespace Sintering
       this->n_global_levels_0 =
         tria.n_global_levels() + n_refinements_remaining;
 
+      // Build the final initial mesh before any DoFs are distributed
+      if (params.adaptivity_data.init_refinement_from_geometry &&
+          (params.adaptivity_data.refinement_frequency > 0 ||
+           params.geometry_data.global_refinement != "Full"))
+        refine_grid_from_geometry(*initial_solution);
+
       initialize();
 
       const auto initialize_solution =
@@ -240,17 +261,20 @@ namespace Sintering
                         ") exceeds the number of blocks provided (" +
                         std::to_string(solution_ptr.size()) + ")."));
 
-          for (unsigned int c = 0; c < initial_solution->n_components(); ++c)
-            {
-              initial_solution->set_component(c);
+          // Evaluate all components at once in a single sweep
+          const std::vector<typename VectorType::BlockType *> component_ptr(
+            solution_ptr.begin(),
+            solution_ptr.begin() + initial_solution->n_components());
 
-              VectorTools::interpolate(mapping,
-                                       dof_handler,
-                                       *initial_solution,
-                                       *solution_ptr[c]);
+          VectorTools::interpolate_components(mapping,
+                                              dof_handler,
+                                              *initial_solution,
+                                              component_ptr);
 
-              constraints.distribute(*solution_ptr[c]);
-              solution_ptr[c]->zero_out_ghost_values();
+          for (const auto ptr : component_ptr)
+            {
+              constraints.distribute(*ptr);
+              ptr->zero_out_ghost_values();
             }
         };
 
@@ -517,15 +541,207 @@ namespace Sintering
 
       helper = std::make_unique<dealii::parallel::Helper<dim>>(tria);
 
-      const auto weight_function = parallel::hanging_nodes_weighting<dim>(
+      const auto hanging_nodes_weight = parallel::hanging_nodes_weighting<dim>(
         *helper, params.geometry_data.hanging_node_weight);
-      tria.signals.weight.connect(weight_function);
+
+      // With grain cut-off, the cost of a cell grows with the number of
+      // active order parameters
+      tria.signals.weight.connect(
+        [this, hanging_nodes_weight](
+          const typename Triangulation<dim>::cell_iterator &cell,
+          const typename Triangulation<dim>::CellStatus     status)
+          -> unsigned int {
+          const unsigned int weight = hanging_nodes_weight(cell, status);
+
+          if (params.geometry_data.grain_weight == 0.0 ||
+              cell_n_active_grains.size() != tria.n_active_cells())
+            return weight;
+
+          unsigned int n_active_grains = 0;
+          if (cell->is_active())
+            n_active_grains = cell_n_active_grains[cell->active_cell_index()];
+          else
+            for (const auto &child : cell->child_iterators())
+              if (child->is_active())
+                n_active_grains =
+                  std::max(n_active_grains,
+                           cell_n_active_grains[child->active_cell_index()]);
+
+          return weight * (1.0 + params.geometry_data.grain_weight *
+                                   n_active_grains);
+        });
 
       tria.repartition();
 
       return n_refinements_remaining;
     }
 
+    /* Refine the mesh at the interfaces of the initial geometry, so that the
+     * solution has to be set up only once on the final mesh. A cell is
+     * considered to be at an interface if the range of values of an order
+     * parameter evaluated at its vertices, face centers and center overlaps
+     * with [interface_val_min, interface_val_max].
+     */
+    void
+    refine_grid_from_geometry(const InitialValues<dim> &initial_values)
+    {
+      MyScope("Problem::refine_grid_from_geometry");
+
+      const unsigned int max_allowed_level =
+        (this->n_global_levels_0 - 1) +
+        params.adaptivity_data.max_refinement_depth;
+      const unsigned int min_allowed_level =
+        (this->n_global_levels_0 - 1) -
+        std::min((this->n_global_levels_0 - 1),
+                 params.adaptivity_data.min_refinement_depth);
+
+      const unsigned int n_init_refinements =
+        std::max(std::min(tria.n_global_levels() - 1,
+                          params.adaptivity_data.min_refinement_depth),
+                 this->n_global_levels_0 - tria.n_global_levels() +
+                   params.adaptivity_data.max_refinement_depth);
+
+      const unsigned int n_order_params =
+        initial_values.n_order_parameters();
+
+      Vector<double>      values(initial_values.n_components());
+      std::vector<double> values_min(n_order_params);
+      std::vector<double> values_max(n_order_params);
+
+      const auto is_at_interface = [&](const auto &cell) {
+        std::fill(values_min.begin(),
+                  values_min.end(),
+                  std::numeric_limits<double>::max());
+        std::fill(values_max.begin(),
+                  values_max.end(),
+                  std::numeric_limits<double>::lowest());
+
+        const auto process_point = [&](const Point<dim> &p) {
+          initial_values.all_values(p, values);
+
+          for (unsigned int op = 0; op < n_order_params; ++op)
+            {
+              values_min[op] = std::min(values_min[op], values[op + 2]);
+              values_max[op] = std::max(values_max[op], values[op + 2]);
+            }
+        };
+
+        for (const auto v : cell->vertex_indices())
+          process_point(cell->vertex(v));
+        for (const auto f : cell->face_indices())
+          process_point(cell->face(f)->center());
+        process_point(cell->center());
+
+        for (unsigned int op = 0; op < n_order_params; ++op)
+          if (values_max[op] > params.adaptivity_data.interface_val_min &&
+              values_min[op] < params.adaptivity_data.interface_val_max)
+            return true;
+
+        return false;
+      };
+
+      pcout << "Number of geometry-driven refinements to be performed: "
+            << n_init_refinements << std::endl;
+
+      for (unsigned int i = 0; i < n_init_refinements; ++i)
+        {
+          unsigned int n_flagged_cells = 0;
+
+          for (const auto &cell : tria.active_cell_iterators())
+            if (cell->is_locally_owned())
+              {
+                const unsigned int level = cell->level();
+
+                if (is_at_interface(cell))
+                  {
+                    if (level < max_allowed_level)
+                      {
+                        cell->set_refine_flag();
+                        ++n_flagged_cells;
+                      }
+                  }
+                else if (level > min_allowed_level)
+                  {
+                    cell->set_coarsen_flag();
+                    ++n_flagged_cells;
+                  }
+              }
+
+          if (Utilities::MPI::sum(n_flagged_cells, MPI_COMM_WORLD) == 0)
+            break;
+
+          tria.execute_coarsening_and_refinement();
+
+          pcout << "  pass " << i << ": " << tria.n_global_active_cells()
+                << " cells, " << tria.n_global_levels() << " levels"
+                << std::endl;
+        }
+    }
+
+    /* Count the order parameters exceeding the grain cut-off tolerance on
+     * each locally owned cell and report the resulting load imbalance. The
+     * counts are also used to weight the cells during repartitioning.
+     */
+    void
+    update_cell_n_active_grains(const VectorType &  solution,
+                                const unsigned int n_grains,
+                                const std::string &label)
+    {
+      MyScope("Problem::update_cell_n_active_grains");
+
+      const bool has_ghost_elements = solution.has_ghost_elements();
+
+      if (has_ghost_elements == false)
+        solution.update_ghost_values();
+
+      cell_n_active_grains.assign(tria.n_active_cells(), 0);
+
+      Vector<Number> values(dof_handler.get_fe().n_dofs_per_cell());
+
+      unsigned int n_cells           = 0;
+      unsigned int n_cell_components = 0;
+
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (cell->is_locally_owned())
+          {
+            unsigned int counter = 0;
+
+            for (unsigned int b = 0; b < n_grains; ++b)
+              {
+                cell->get_dof_values(solution.block(b + 2), values);
+
+                if (values.linfty_norm() > params.grain_cut_off_tolerance)
+                  counter++;
+              }
+
+            cell_n_active_grains[cell->active_cell_index()] = counter;
+
+            n_cells += 1;
+            n_cell_components += 2 + counter;
+          }
+
+      if (has_ghost_elements == false)
+        solution.zero_out_ghost_values();
+
+      // estimated cost: number of components evaluated on the cells of a rank
+      const auto min_max_avg_n_cells =
+        Utilities::MPI::min_max_avg(n_cells, MPI_COMM_WORLD);
+      const auto min_max_avg_n_cell_components =
+        Utilities::MPI::min_max_avg(n_cell_components, MPI_COMM_WORLD);
+
+      const auto imbalance = [](const auto &stat) {
+        return stat.avg > 0.0 ? stat.max / stat.avg : 1.0;
+      };
+
+      pcout << "Load imbalance " << label
+            << " (max/avg): cells = " << imbalance(min_max_avg_n_cells)
+            << ", estimated cost = " << imbalance(min_max_avg_n_cell_components)
+            << " (min: " << min_max_avg_n_cell_components.min
+            << ", avg: " << min_max_avg_n_cell_components.avg
+            << ", max: " << min_max_avg_n_cell_components.max << ")"
+            << std::endl;
+    }
+
     void
     initialize(const unsigned int n_components = 0)
     {
@@ -583,6 +799,21 @@ namespace Sintering
             mapping, dof_handler, constraints, quad, additional_data);
         }
 
+      // ... single-precision MatrixFree for the Jacobian
+      if (params.nonlinear_data.jacobian_mixed_precision)
+        {
+          MyScope("Problem::initialize::matrix_free_mixed");
+          typename MatrixFree<dim, NumberMixed, VectorizedArrayTypeMixed>::
+            AdditionalData additional_data;
+          additional_data.mapping_update_flags =
+            update_values | update_gradients;
+
+          constraints_mixed.copy_from(constraints);
+
+          matrix_free_mixed.reinit(
+            mapping, dof_handler, constraints_mixed, quad, additional_data);
+        }
+
       if ((params.preconditioners_data.outer_preconditioner == "GMG") ||
           (params.preconditioners_data.outer_preconditioner == "BlockGMG") ||
           ((params.preconditioners_data.outer_preconditioner ==
@@ -844,7 +1075,13 @@ namespace Sintering
         }
 
       SinteringOperatorData<dim, VectorizedArrayType> sintering_data(
-        A, B, kappa_c, kappa_p, mobility_provider, time_integration_order);
+        A,
+        B,
+        kappa_c,
+        kappa_p,
+        mobility_provider,
+        time_integration_order,
+        params.use_linearization_on_the_fly);
 
       pcout << "Mobility type: "
             << (sintering_data.use_tensorial_mobility ? "tensorial" : "scalar")
@@ -858,6 +1095,8 @@ namespace Sintering
 
       TimeIntegration::SolutionHistory<VectorType> solution_history(
         time_integration_order + 1);
+      solution_history.set_precombine_old_solutions(
+        params.time_integration_data.precombine_history);
 
       MGLevelObject<SinteringOperatorData<dim, VectorizedArrayType>>
         mg_sintering_data(0,
@@ -875,12 +1114,54 @@ namespace Sintering
         !params.geometry_data.minimize_order_parameters,
         allow_new_grains,
         params.grain_tracker_data.fast_reassignment,
-        MAX_SINTERING_GRAINS,
+        params.max_order_parameters(MAX_SINTERING_GRAINS),
         params.grain_tracker_data.threshold_lower,
         params.grain_tracker_data.threshold_upper,
         params.grain_tracker_data.buffer_distance_ratio,
         params.grain_tracker_data.buffer_distance_fixed,
-        order_parameters_offset);
+        order_parameters_offset,
+        true /*do_timing*/,
+        params.grain_tracker_data.incremental);
+
+      // Beyond MAX_SINTERING_GRAINS order parameters, only the cut-off kernels
+      // templated on the number of grains active in a cell batch are available
+      const auto check_n_grains = [&](const unsigned int n_grains) {
+        const unsigned int max_grains =
+          params.max_order_parameters(MAX_SINTERING_GRAINS);
+
+        AssertThrow(n_grains <= max_grains,
+                    ExcMessage("Number of grains (" + std::to_string(n_grains) +
+                               ") exceeds the maximum value (" +
+                               std::to_string(max_grains) + ")."));
+
+        if (n_grains <= MAX_SINTERING_GRAINS)
+          return;
+
+        const auto &block_1_preconditioner =
+          params.preconditioners_data.block_preconditioner_2_data
+            .block_1_preconditioner;
+
+        AssertThrow(
+          (params.grain_cut_off_tolerance != 0.0) && !params.matrix_based &&
+            !params.nonlinear_data.fdm_jacobian_approximation &&
+            !params.advection_data.enable &&
+            !params.output_data.fluxes_divergences &&
+            !params.profiling_data.run_vmults &&
+            (params.time_integration_data.predictor == "None") && !transfer &&
+            (params.preconditioners_data.outer_preconditioner ==
+             "BlockPreconditioner2") &&
+            (block_1_preconditioner == "BlockAMG" ||
+             block_1_preconditioner == "BlockILU"),
+          ExcMessage(
+            "Number of grains (" + std::to_string(n_grains) +
+            ") exceeds MAX_SINTERING_GRAINS (" +
+            std::to_string(MAX_SINTERING_GRAINS) +
+            "). This is only supported matrix-free with grain cut-off, "
+            "without advection and predictor, and with BlockPreconditioner2 "
+            "using BlockAMG or BlockILU for the Allen-Cahn block."));
+      };
+
+      check_n_grains(sintering_data.n_grains());
 
       // Advection physics for shrinkage
       AdvectionMechanism<dim, Number, VectorizedArrayType> advection_mechanism(
@@ -915,9 +1196,47 @@ namespace Sintering
         params.material_data.mechanics_data.nu,
         plane_type);
 
+      // Single-precision copy of the Jacobian; residual and solution remain
+      // in double precision
+      SinteringOperatorData<dim, VectorizedArrayTypeMixed> sintering_data_mixed(
+        A,
+        B,
+        kappa_c,
+        kappa_p,
+        mobility_provider,
+        time_integration_order,
+        params.use_linearization_on_the_fly);
+
+      TimeIntegration::SolutionHistory<VectorTypeMixed> solution_history_mixed(
+        time_integration_order + 1);
+
+      AdvectionMechanism<dim, NumberMixed, VectorizedArrayTypeMixed>
+        advection_mechanism_mixed;
+
+      NonLinearOperatorMixed nonlinear_operator_mixed(
+        matrix_free_mixed,
+        constraints_mixed,
+        sintering_data_mixed,
+        solution_history_mixed,
+        advection_mechanism_mixed,
+        false,
+        params.use_tensorial_mobility_gradient_on_the_fly);
+
       std::unique_ptr<NonLinearSolvers::JacobianBase<Number>> jacobian_operator;
 
-      if (params.nonlinear_data.jacobi_free == false)
+      if (params.nonlinear_data.jacobian_mixed_precision)
+        {
+          AssertThrow(!params.nonlinear_data.jacobi_free &&
+                        !params.matrix_based && !params.advection_data.enable,
+                      ExcMessage("The mixed-precision Jacobian is only "
+                                 "supported matrix-free without advection."));
+
+          jacobian_operator =
+            std::make_unique<NonLinearSolvers::JacobianMixedPrecision<
+              Number,
+              NonLinearOperatorMixed>>(nonlinear_operator_mixed);
+        }
+      else if (params.nonlinear_data.jacobi_free == false)
         jacobian_operator = std::make_unique<
           NonLinearSolvers::JacobianWrapper<Number, NonLinearOperator>>(
           nonlinear_operator);
@@ -1010,6 +1329,21 @@ namespace Sintering
           *preconditioner,
           *solver_control_l,
           params.nonlinear_data.gmres_data);
+      else if (params.nonlinear_data.l_solver == "GCRODR")
+        linear_solver = std::make_unique<LinearSolvers::SolverGCRODRWrapper<
+          NonLinearSolvers::JacobianBase<Number>,
+          Preconditioners::PreconditionerBase<Number>>>(
+          *jacobian_operator,
+          *preconditioner,
+          *solver_control_l,
+          params.nonlinear_data.gmres_data);
+      else if (params.nonlinear_data.l_solver == "PipelinedGMRES")
+        linear_solver =
+          std::make_unique<LinearSolvers::SolverPipelinedGMRESWrapper<
+            NonLinearSolvers::JacobianBase<Number>,
+            Preconditioners::PreconditionerBase<Number>>>(*jacobian_operator,
+                                                          *preconditioner,
+                                                          *solver_control_l);
       else if (params.nonlinear_data.l_solver == "Relaxation")
         linear_solver = std::make_unique<LinearSolvers::SolverRelaxation<
           NonLinearSolvers::JacobianBase<Number>,
@@ -1122,6 +1456,38 @@ namespace Sintering
 
         nonlinear_operator.do_update();
 
+        if (params.nonlinear_data.jacobian_mixed_precision)
+          {
+            sintering_data_mixed.set_n_components(
+              sintering_data.n_components());
+            sintering_data_mixed.time_data.set_all_dt(
+              std::vector<NumberMixed>(dts.begin(), dts.end()));
+            sintering_data_mixed.set_time(sintering_data.get_time());
+
+            VectorTypeMixed current_u_mixed(current_u.n_blocks());
+            for (unsigned int b = 0; b < current_u.n_blocks(); ++b)
+              matrix_free_mixed.initialize_dof_vector(current_u_mixed.block(b));
+            current_u_mixed.copy_locally_owned_data_from(current_u);
+
+            if (params.grain_cut_off_tolerance != 0.0)
+              sintering_data_mixed.set_component_mask(
+                matrix_free_mixed,
+                current_u_mixed,
+                params.advection_data.enable,
+                save_all_blocks,
+                params.grain_cut_off_tolerance,
+                false);
+
+            sintering_data_mixed.fill_quadrature_point_values(
+              matrix_free_mixed,
+              current_u_mixed,
+              params.advection_data.enable,
+              save_all_blocks);
+
+            // constrained indices might have changed due to AMR
+            nonlinear_operator_mixed.clear();
+          }
+
         if (params.nonlinear_data.fdm_jacobian_approximation)
           {
             AssertThrow(params.matrix_based, ExcNotImplemented());
@@ -1374,20 +1740,33 @@ namespace Sintering
 
       if (params.nonlinear_data.nonlinear_solver_type == "damped")
         {
+          NonLinearSolvers::NewtonSolverAdditionalData additional_data(
+            params.nonlinear_data.newton_do_update,
+            params.nonlinear_data.newton_threshold_newton_iter,
+            params.nonlinear_data.newton_threshold_linear_iter,
+            params.nonlinear_data.newton_reuse_preconditioner,
+            params.nonlinear_data.newton_use_damping);
+
+          additional_data.forcing_term   = params.nonlinear_data.forcing_term;
+          additional_data.linear_rel_tol = params.nonlinear_data.l_rel_tol;
+          additional_data.forcing_term_max =
+            params.nonlinear_data.forcing_term_max;
+          additional_data.forcing_term_gamma =
+            params.nonlinear_data.forcing_term_gamma;
+          additional_data.forcing_term_alpha =
+            params.nonlinear_data.forcing_term_alpha;
+          additional_data.preconditioner_update_policy =
+            params.nonlinear_data.newton_update_policy;
+
           NonLinearSolvers::DampedNewtonSolver<VectorType> non_linear_solver(
-            statistics,
-            NonLinearSolvers::NewtonSolverAdditionalData(
-              params.nonlinear_data.newton_do_update,
-              params.nonlinear_data.newton_threshold_newton_iter,
-              params.nonlinear_data.newton_threshold_linear_iter,
-              params.nonlinear_data.newton_reuse_preconditioner,
-              params.nonlinear_data.newton_use_damping));
+            statistics, additional_data);
 
           non_linear_solver.reinit_vector = [&](auto &vector) {
             ScopedName sc("reinit_vector");
             MyScope    scope(timer, sc);
 
             nonlinear_operator.initialize_dof_vector(vector);
+            vector.set_fused_communication(params.fused_block_communication);
           };
 
           non_linear_solver.residual             = nl_residual;
@@ -1395,6 +1774,25 @@ namespace Sintering
           non_linear_solver.setup_preconditioner = nl_setup_preconditioner;
           non_linear_solver.solve_with_jacobian  = nl_solve_with_jacobian;
 
+          if (params.nonlinear_data.forcing_term != "Constant")
+            {
+              auto reduction_control =
+                dynamic_cast<ReductionControl *>(solver_control_l.get());
+
+              AssertThrow(reduction_control,
+                          ExcMessage("Adaptive forcing terms require a "
+                                     "ReductionControl."));
+
+              non_linear_solver.set_linear_relative_tolerance =
+                [reduction_control](const double tol) {
+                  reduction_control->set_reduction(tol);
+                };
+              non_linear_solver.apply_jacobian = [&](const auto &src,
+                                                     auto &      dst) {
+                jacobian_operator->vmult(dst, src);
+              };
+            }
+
           if (params.nonlinear_data.verbosity >= 1) // TODO
             non_linear_solver.check_iteration_status =
               nl_check_iteration_status;
@@ -1547,8 +1945,9 @@ namespace Sintering
       // set initial condition
 
       std::function<void(VectorType &)> f_init =
-        [&nonlinear_operator](VectorType &v) {
+        [&nonlinear_operator, this](VectorType &v) {
           nonlinear_operator.initialize_dof_vector(v);
+          v.set_fused_communication(params.fused_block_communication);
         };
 
       solution_history.apply(f_init);
@@ -1615,6 +2014,11 @@ namespace Sintering
               }
           };
 
+          if (params.grain_cut_off_tolerance != 0.0)
+            update_cell_n_active_grains(solution,
+                                        sintering_data.n_grains(),
+                                        "before repartitioning");
+
           const unsigned int block_estimate_start = 2;
           const unsigned int block_estimate_end = sintering_data.n_components();
           coarsen_and_refine_mesh(vector_solutions_except_recent,
@@ -1636,6 +2040,11 @@ namespace Sintering
                         additional_initializations.end(),
                         [](auto &a_init) { a_init(); });
 
+          if (params.grain_cut_off_tolerance != 0.0)
+            update_cell_n_active_grains(solution,
+                                        sintering_data.n_grains(),
+                                        "after repartitioning");
+
           const auto old_old_solutions = solution_history.filter(false, false);
           old_old_solutions.update_ghost_values();
 
@@ -1733,12 +2142,7 @@ namespace Sintering
                       << n_components_old << " to " << n_components_new
                       << "\033[0m" << std::endl;
 
-                AssertThrow(n_grains_new <= MAX_SINTERING_GRAINS,
-                            ExcMessage("Number of grains (" +
-                                       std::to_string(n_grains_new) +
-                                       ") exceeds the maximum value (" +
-                                       std::to_string(MAX_SINTERING_GRAINS) +
-                                       ")."));
+                check_n_grains(n_grains_new);
 
                 nonlinear_operator.clear();
                 non_linear_solver_executor->clear();
@@ -1910,8 +2314,9 @@ namespace Sintering
         solution_history.filter(true, false, true).get_all_blocks_raw(), timer);
 
       // initial local refinement
-      if (t == 0.0 && (params.adaptivity_data.refinement_frequency > 0 ||
-                       params.geometry_data.global_refinement != "Full"))
+      if (t == 0.0 && !params.adaptivity_data.init_refinement_from_geometry &&
+          (params.adaptivity_data.refinement_frequency > 0 ||
+           params.geometry_data.global_refinement != "Full"))
         {
           // Initialize only the current solution
           const auto solution_ptr =
@@ -2283,12 +2688,23 @@ namespace Sintering
                 statistics.clear();
 
                 if (params.grain_cut_off_tolerance != 0.0)
-                  sintering_data.set_component_mask(
-                    matrix_free,
-                    solution,
-                    params.advection_data.enable,
-                    save_all_blocks,
-                    params.grain_cut_off_tolerance);
+                  {
+                    sintering_data.set_component_mask(
+                      matrix_free,
+                      solution,
+                      params.advection_data.enable,
+                      save_all_blocks,
+                      params.grain_cut_off_tolerance);
+
+                    AssertThrow(
+                      sintering_data.n_max_relevant_grains() <=
+                        MAX_SINTERING_GRAINS,
+                      ExcMessage(
+                        "Number of grains in a cell batch (" +
+                        std::to_string(sintering_data.n_max_relevant_grains()) +
+                        ") exceeds the maximum value (" +
+                        std::to_string(MAX_SINTERING_GRAINS) + ")."));
+                  }
 
                 // note: input/output (solution) needs/has the right
                 // constraints applied
@@ -2302,7 +2718,19 @@ namespace Sintering
                       << " solved in " << statistics.n_newton_iterations()
                       << " Newton iterations and "
                       << statistics.n_linear_iterations()
-                      << " linear iterations" << std::endl;
+                      << " linear iterations";
+                if (params.nonlinear_data.newton_update_policy != "Threshold")
+                  pcout << " (preconditioner updates: "
+                        << statistics.n_preconditioner_updates() << ")";
+                if (params.nonlinear_data.forcing_term != "Constant")
+                  {
+                    pcout << " (forcing terms / linear iterations:";
+                    for (const auto &[eta, n_iterations] :
+                         statistics.get_forcing_terms())
+                      pcout << " " << eta << "/" << n_iterations;
+                    pcout << ")";
+                  }
+                pcout << std::endl;
 
                 n_timestep += 1;
                 n_linear_iterations += statistics.n_linear_iterations();
@@ -2369,6 +2797,11 @@ namespace Sintering
                     // sintering-related data
                     const auto mc_sintering_data = Utilities::MPI::sum<double>(
                       sintering_data.memory_consumption(), MPI_COMM_WORLD);
+                    const auto mc_sintering_data_saved =
+                      Utilities::MPI::sum<double>(
+                        sintering_data.memory_consumption_saved() +
+                          sintering_data_mixed.memory_consumption_saved(),
+                        MPI_COMM_WORLD);
                     const auto mc_nonlinear_operator =
                       Utilities::MPI::sum<double>(
                         nonlinear_operator.memory_consumption(),
@@ -2378,11 +2811,17 @@ namespace Sintering
                         solution_history.memory_consumption(), MPI_COMM_WORLD);
                     const auto mc_preconditioner = Utilities::MPI::sum<double>(
                       preconditioner->memory_consumption(), MPI_COMM_WORLD);
+                    const auto mc_mixed_precision = Utilities::MPI::sum<double>(
+                      matrix_free_mixed.memory_consumption() +
+                        sintering_data_mixed.memory_consumption() +
+                        nonlinear_operator_mixed.memory_consumption(),
+                      MPI_COMM_WORLD);
 
                     const auto mc_total =
                       mc_tria + mc_dofhandler + mc_affine_constraints +
-                      mc_matrix_free + mc_nonlinear_operator +
-                      mc_solution_history + mc_preconditioner;
+                      mc_matrix_free + mc_sintering_data +
+                      mc_nonlinear_operator + mc_solution_history +
+                      mc_preconditioner + mc_mixed_precision;
 
                     pcout << "Memory consumption:     " << mc_total / 1e9
                           << std::endl;
@@ -2396,12 +2835,19 @@ namespace Sintering
                           << std::endl;
                     pcout << " - sintering data:      "
                           << mc_sintering_data / 1e9 << std::endl;
+                    if (params.use_linearization_on_the_fly)
+                      pcout << "   (saved on the fly:   "
+                            << mc_sintering_data_saved / 1e9 << ")"
+                            << std::endl;
                     pcout << " - non-linear operator: "
                           << mc_nonlinear_operator / 1e9 << std::endl;
                     pcout << " - vectors:             "
                           << mc_solution_history / 1e9 << std::endl;
                     pcout << " - preconditioner:      "
                           << mc_preconditioner / 1e9 << std::endl;
+                    if (params.nonlinear_data.jacobian_mixed_precision)
+                      pcout << " - mixed precision:     "
+                            << mc_mixed_precision / 1e9 << std::endl;
                   }
 
                 // Posptrocessing to calculate divergences of fluxes
@@ -2425,7 +2871,8 @@ namespace Sintering
                   }
 
                 // Print grain forces
-                if (params.advection_data.enable)
+                if (params.advection_data.enable &&
+                    params.advection_data.print_forces)
                   advection_mechanism.print_forces(pcout, grain_tracker);
               }
             catch (const NonLinearSolvers::ExcNewtonDidNotConverge &e)
@@ -2627,9 +3074,11 @@ namespace Sintering
                 data_out.add_data_vector(solution.block(b), "u");
             }
 
-          sintering_operator.add_data_vectors(data_out,
-                                              solution,
-                                              params.output_data.fields);
+          // Derived fields are only instantiated up to MAX_SINTERING_GRAINS
+          if (sintering_operator.n_grains() <= MAX_SINTERING_GRAINS)
+            sintering_operator.add_data_vectors(data_out,
+                                                solution,
+                                                params.output_data.fields);
 
           // Output additional data
           if (additional_output)
@@ -3,6 +3,8 @@
 #include <deal.II/base/function.h>
 #include <deal.II/base/point.h>
 
+#include <deal.II/lac/vector.h>
+
 namespace Sintering
 {
   using namespace dealii;
@@ -38,6 +40,15 @@ namespace Sintering
       return this->do_value(p, current_component);
     }
 
+    /* Evaluate all components (c, mu and all order parameters) at once. */
+    void
+    all_values(const Point<dim> &p, Vector<double> &values) const
+    {
+      AssertDimension(values.size(), n_components());
+
+      this->do_all_values(p, values);
+    }
+
     virtual std::pair<Point<dim>, Point<dim>>
     get_domain_boundaries() const = 0;
 
@@ -74,6 +85,15 @@ namespace Sintering
     virtual double
     do_value(const Point<dim> &p, const unsigned int component) const = 0;
 
+    /* The default implementation evaluates the components one by one,
+     * derived classes might override it to share work between them. */
+    virtual void
+    do_all_values(const Point<dim> &p, Vector<double> &values) const
+    {
+      for (unsigned int c = 0; c < values.size(); ++c)
+        values[c] = this->do_value(p, c);
+    }
+
     double
     is_in_sphere(const Point<dim> &point,
                  const Point<dim> &center,
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <deal.II/base/bounding_box.h>
+
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/sparsity_tools.h>
 
+#include <deal.II/numerics/rtree.h>
+
 #include "initial_values.h"
 #include "particle.h"
+#include "particle_cloud.h"
 
 namespace Sintering
 {
@@ -19,8 +24,22 @@ namespace Sintering
                        const double                      interface_width,
                        const bool   minimize_order_parameters,
                        const double interface_buffer_ratio = 0.5)
+      : InitialValuesCloud(ParticleCloud<dim>{particles_in},
+                           interface_width,
+                           minimize_order_parameters,
+                           interface_buffer_ratio)
+    {}
+
+    /* Initialize from a cloud which might provide precomputed contacts and
+     * coloring. The coloring is only used if it has been computed for the
+     * same interface parameters.
+     */
+    InitialValuesCloud(const ParticleCloud<dim> &cloud,
+                       const double              interface_width,
+                       const bool                minimize_order_parameters,
+                       const double              interface_buffer_ratio = 0.5)
       : InitialValues<dim>()
-      , particles(particles_in)
+      , particles(cloud.particles)
       , interface_width(interface_width)
     {
       if (dim == 2)
@@ -66,114 +85,91 @@ namespace Sintering
 
       const unsigned int n_particles = particles.size();
 
-      // DSP for colorization if order parameters are compressed
-      DynamicSparsityPattern dsp(n_particles);
-
-      // Detect contacts
+      // Index the particles, a box contains the whole particle including its
+      // diffuse interface
+      std::vector<std::pair<BoundingBox<dim>, unsigned int>> particles_boxes;
       for (unsigned int i = 0; i < n_particles; i++)
-        {
-          auto &p1 = particles[i];
+        particles_boxes.emplace_back(
+          get_bounding_box(particles[i],
+                           particles[i].radius + interface_width / 2.0),
+          i);
 
-          for (unsigned int j = 0; j < n_particles; j++)
-            {
-              if (i != j)
-                {
-                  const auto &p2 = particles[j];
+      particles_tree = pack_rtree(particles_boxes);
 
-                  // Compute directional vector from particle 1 to particle 2 of
-                  // the contact pair, this defines local x-axis and the
-                  // corresponding unitary vector ex
-                  const dealii::Point<dim> dir_vec(p2.center - p1.center);
-                  const double             distance = dir_vec.norm();
-                  const dealii::Point<dim> ex       = dir_vec / distance;
+      const bool use_precomputed_colors =
+        minimize_order_parameters &&
+        cloud.has_colors_for(interface_width, interface_buffer_ratio);
+      const bool compute_colors =
+        minimize_order_parameters && !use_precomputed_colors;
 
-                  const double r1 = p1.radius;
-                  const double r2 = p2.radius;
+      // DSP for colorization if order parameters are compressed
+      DynamicSparsityPattern dsp(compute_colors ? n_particles : 0);
 
-                  // The maximum possible distance between the centers of the
-                  // particles
-                  const double dist_max = r1 + r2;
+      // Use precomputed contacts, the neighbours are sorted as if they were
+      // detected below
+      if (cloud.has_contacts)
+        {
+          std::vector<std::pair<unsigned int, unsigned int>> pairs;
+          for (const auto &[i, j] : cloud.contacts)
+            {
+              pairs.emplace_back(i, j);
+              pairs.emplace_back(j, i);
+            }
 
-                  // If distance is smaller than the maximum value, then we have
-                  // an overlap
-                  if (distance <= dist_max - 1e-3 * dist_max)
-                    {
-                      // Compute the radius of the neck
-                      const double s = (r1 + r2 + distance) / 2;
-                      const double r0 =
-                        2 / distance *
-                        std::sqrt(s * (s - r1) * (s - r2) * (s - distance));
-
-                      // Distance from the center of particle 1 to the center of
-                      // the neck
-                      const double dm = std::sqrt(r1 * r1 - r0 * r0);
-
-                      // Compute unitary vector ey of the y-axis
-                      dealii::Point<dim> ey;
-                      if (dim == 2)
-                        {
-                          ey = dealii::cross_product_2d(ex);
-                        }
-                      else if (dim == 3)
-                        {
-                          dealii::Point<dim> current_z_orientation =
-                            get_orientation_point(p1.center, ex);
-                          dealii::Point<dim> z_temp(current_z_orientation -
-                                                    p1.center);
-
-                          ey = dealii::cross_product_3d(z_temp, ex);
-                          ey /= ey.norm();
-                        }
-
-                      // Build up the rotation matrix of the local coordinate
-                      // system
-                      dealii::Tensor<2, dim> rotation_matrix =
-                        dealii::outer_product(ex0, ex) +
-                        dealii::outer_product(ey0, ey);
-                      if (dim == 3)
-                        {
-                          const dealii::Point<dim> ez(
-                            dealii::cross_product_3d(ex, ey));
-                          rotation_matrix += dealii::outer_product(ez0, ez);
-                        }
-
-                      // Coordinate of the central contact point in global
-                      // coordinates
-                      const dealii::Point<dim> contact_center =
-                        p1.center + dm * ex;
-
-                      // Create a new contact pair
-                      auto key = std::make_pair(i, j);
-
-                      const Contact c{p1.id,
-                                      p2.id,
-                                      rotation_matrix,
-                                      contact_center};
-
-                      contacts[key] = c;
-
-                      // Add j-th neighbour for the i-th particle
-                      p1.neighbours.push_back(j);
-                    }
+          std::sort(pairs.begin(), pairs.end());
 
-                  /* We also prepare for colorization if order parameters are
-                   * compressed.
-                   */
-                  if (minimize_order_parameters)
-                    {
-                      double buffer = interface_width +
-                                      interface_buffer_ratio * interface_width;
-                      if (distance <= dist_max + buffer)
-                        {
-                          dsp.add(i, j);
-                        }
-                    }
-                }
-            }
+          for (const auto &[i, j] : pairs)
+            add_contact(i, j);
         }
 
+      // Only the neighbors within this distance are relevant
+      const double buffer =
+        interface_width + interface_buffer_ratio * interface_width;
+      const double neighbor_distance = compute_colors ? buffer : 0.0;
+
+      // Detect contacts and prepare colorization
+      if (!cloud.has_contacts || compute_colors)
+        for (unsigned int i = 0; i < n_particles; i++)
+          {
+            const auto &p1 = particles[i];
+
+            for (const unsigned int j : find_particles(
+                   get_bounding_box(p1, p1.radius + neighbor_distance)))
+              {
+                if (i != j)
+                  {
+                    const auto &p2 = particles[j];
+
+                    const double distance = p1.center.distance(p2.center);
+
+                    // The maximum possible distance between the centers of the
+                    // particles
+                    const double dist_max = p1.radius + p2.radius;
+
+                    // If distance is smaller than the maximum value, then we
+                    // have an overlap
+                    if (!cloud.has_contacts &&
+                        distance <= dist_max - 1e-3 * dist_max)
+                      add_contact(i, j);
+
+                    /* We also prepare for colorization if order parameters
+                     * are compressed.
+                     */
+                    if (compute_colors && distance <= dist_max + buffer)
+                      dsp.add(i, j);
+                  }
+              }
+          }
+
       // Build colorization if compressed
-      if (minimize_order_parameters)
+      if (use_precomputed_colors)
+        {
+          for (unsigned int i = 0; i < n_particles; i++)
+            {
+              order_parameter_to_grains[cloud.colors[i]].push_back(i);
+            }
+        }
+      else if (minimize_order_parameters)
         {
           SparsityPattern sp;
           sp.copy_from(dsp);
@@ -194,6 +190,11 @@ namespace Sintering
             }
         }
       order_parameters_num = order_parameter_to_grains.size();
+
+      particle_to_order_parameter.resize(n_particles);
+      for (const auto &[op, pids] : order_parameter_to_grains)
+        for (const auto pid : pids)
+          particle_to_order_parameter[pid] = op;
     }
 
     double
@@ -204,8 +205,10 @@ namespace Sintering
         {
           double c_main = 0;
 
-          for (const auto &particle_current : particles)
+          for (const auto pid : find_particles(p))
             {
+              const auto &particle_current = particles[pid];
+
               double c_current = this->is_in_sphere(p,
                                                     particle_current.center,
                                                     particle_current.radius);
@@ -230,11 +233,20 @@ namespace Sintering
 
           const unsigned int order_parameter = component - 2;
 
+          AssertThrow(order_parameter_to_grains.find(order_parameter) !=
+                        order_parameter_to_grains.end(),
+                      ExcMessage("No grains assigned to order parameter " +
+                                 std::to_string(order_parameter)));
+
           double ret_val = 0;
 
-          for (const auto pid : order_parameter_to_grains.at(order_parameter))
+          // Only the particles close to the point can contribute
+          for (const auto pid : find_particles(p))
             {
-              const auto &particle_current = particles.at(pid);
+              if (particle_to_order_parameter[pid] != order_parameter)
+                continue;
+
+              const auto &particle_current = particles[pid];
               ret_val = this->value_for_particle(p, particle_current);
 
               if (ret_val != 0)
@@ -247,6 +259,31 @@ namespace Sintering
         }
     }
 
+    void
+    do_all_values(const dealii::Point<dim> &p,
+                  Vector<double> &          values) const final
+    {
+      values = 0;
+
+      // Evaluate the particles close to the point only once for all
+      // components, for each order parameter the first particle with a
+      // non-zero value is taken as in do_value()
+      for (const auto pid : find_particles(p))
+        {
+          const auto &particle_current = particles[pid];
+
+          values[0] = std::max(values[0],
+                               this->is_in_sphere(p,
+                                                  particle_current.center,
+                                                  particle_current.radius));
+
+          auto &eta = values[2 + particle_to_order_parameter[pid]];
+
+          if (eta == 0)
+            eta = this->value_for_particle(p, particle_current);
+        }
+    }
+
     std::pair<dealii::Point<dim>, dealii::Point<dim>>
     get_domain_boundaries() const final
     {
@@ -259,6 +296,29 @@ namespace Sintering
       return order_parameter_to_grains;
     }
 
+    const std::vector<unsigned int> &
+    get_particle_to_order_parameter() const
+    {
+      return particle_to_order_parameter;
+    }
+
+    // Pairs of overlapping particles (i < j)
+    std::vector<std::pair<unsigned int, unsigned int>>
+    get_contacts() const
+    {
+      std::vector<std::pair<unsigned int, unsigned int>> pairs;
+
+      for (const auto &[key, contact] : contacts)
+        {
+          (void)contact;
+
+          if (key.first < key.second)
+            pairs.push_back(key);
+        }
+
+      return pairs;
+    }
+
     double
     get_r_max() const final
     {
@@ -341,6 +401,109 @@ namespace Sintering
     // Map order parameters to specific grains
     std::map<unsigned int, std::vector<unsigned int>> order_parameter_to_grains;
 
+    // Inverse mapping of the above
+    std::vector<unsigned int> particle_to_order_parameter;
+
+    // Spatial index of the particles
+    RTree<std::pair<BoundingBox<dim>, unsigned int>> particles_tree;
+
+    BoundingBox<dim>
+    get_bounding_box(const Particle<dim> &particle, const double radius) const
+    {
+      Point<dim> lower, upper;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          lower[d] = particle.center[d] - radius;
+          upper[d] = particle.center[d] + radius;
+        }
+
+      return BoundingBox<dim>(std::make_pair(lower, upper));
+    }
+
+    // Indices of the particles whose boxes intersect the given geometry, in
+    // ascending order
+    template <typename Geometry>
+    std::vector<unsigned int>
+    find_particles(const Geometry &geometry) const
+    {
+      std::vector<unsigned int> pids;
+
+      for (const auto &[box, pid] :
+           particles_tree | boost::geometry::index::adaptors::queried(
+                              boost::geometry::index::intersects(geometry)))
+        {
+          (void)box;
+          pids.push_back(pid);
+        }
+
+      std::sort(pids.begin(), pids.end());
+
+      return pids;
+    }
+
+    void
+    add_contact(const unsigned int i, const unsigned int j)
+    {
+      auto &      p1 = particles[i];
+      const auto &p2 = particles[j];
+
+      // Compute directional vector from particle 1 to particle 2 of the
+      // contact pair, this defines local x-axis and the corresponding unitary
+      // vector ex
+      const dealii::Point<dim> dir_vec(p2.center - p1.center);
+      const double             distance = dir_vec.norm();
+      const dealii::Point<dim> ex       = dir_vec / distance;
+
+      const double r1 = p1.radius;
+      const double r2 = p2.radius;
+
+      // Compute the radius of the neck
+      const double s = (r1 + r2 + distance) / 2;
+      const double r0 =
+        2 / distance * std::sqrt(s * (s - r1) * (s - r2) * (s - distance));
+
+      // Distance from the center of particle 1 to the center of the neck
+      const double dm = std::sqrt(r1 * r1 - r0 * r0);
+
+      // Compute unitary vector ey of the y-axis
+      dealii::Point<dim> ey;
+      if (dim == 2)
+        {
+          ey = dealii::cross_product_2d(ex);
+        }
+      else if (dim == 3)
+        {
+          dealii::Point<dim> current_z_orientation =
+            get_orientation_point(p1.center, ex);
+          dealii::Point<dim> z_temp(current_z_orientation - p1.center);
+
+          ey = dealii::cross_product_3d(z_temp, ex);
+          ey /= ey.norm();
+        }
+
+      // Build up the rotation matrix of the local coordinate system
+      dealii::Tensor<2, dim> rotation_matrix =
+        dealii::outer_product(ex0, ex) + dealii::outer_product(ey0, ey);
+      if (dim == 3)
+        {
+          const dealii::Point<dim> ez(dealii::cross_product_3d(ex, ey));
+          rotation_matrix += dealii::outer_product(ez0, ez);
+        }
+
+      // Coordinate of the central contact point in global coordinates
+      const dealii::Point<dim> contact_center = p1.center + dm * ex;
+
+      // Create a new contact pair
+      auto key = std::make_pair(i, j);
+
+      const Contact c{p1.id, p2.id, rotation_matrix, contact_center};
+
+      contacts[key] = c;
+
+      // Add j-th neighbour for the i-th particle
+      p1.neighbours.push_back(j);
+    }
+
     double
     drand(double dmin, double dmax) const
     {
@@ -7,7 +7,7 @@
               ExcMessage("Number of components " +                     \
                          std::to_string(n_comp_nt) +                   \
                          " is not precompiled!"));                     \
-  AssertThrow(n_comp_nt <= max_components +2,                          \
+  AssertThrow(n_comp_nt <= max_components,                             \
               ExcMessage("Number of components " +                     \
                          std::to_string(n_comp_nt) +                   \
                          " is not precompiled!"));                     \
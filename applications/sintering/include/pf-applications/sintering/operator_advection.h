@@ -318,13 +318,8 @@ namespace Sintering
 
       advection_mechanism.set_grain_table(index_ptr, index_values);
 
-      // Perform global communication
-      MPI_Allreduce(MPI_IN_PLACE,
-                    advection_mechanism.get_grains_data().data(),
-                    advection_mechanism.get_grains_data().size(),
-                    Utilities::MPI::mpi_type_id_for_type<Number>,
-                    MPI_SUM,
-                    MPI_COMM_WORLD);
+      // Perform communication only with the owners of the touched segments
+      advection_mechanism.reduce_grains_data(MPI_COMM_WORLD);
     }
 
     const double k;
@@ -197,13 +197,17 @@ namespace Sintering
       , do_timing(true)
     {}
 
-    virtual ~OperatorBase() = default;
+    virtual ~OperatorBase()
+    {
+      tria_connection.disconnect();
+    }
 
     virtual void
     clear()
     {
-      this->system_matrix.clear();
-      this->block_system_matrix.clear();
+      // note: the sparsity patterns and the matrices are kept as long as
+      // the DoF layout is unchanged, they are released as soon as the
+      // triangulation changes
       src_.reinit(0);
       dst_.reinit(0);
 
@@ -377,7 +381,11 @@ namespace Sintering
         }
       else
         {
-          system_matrix.vmult(dst, src);
+          // Trilinos matrices are only available in double precision
+          if constexpr (std::is_same_v<Number, double>)
+            system_matrix.vmult(dst, src);
+          else
+            AssertThrow(false, ExcNotImplemented());
         }
 
       post_vmult(dst, src);
@@ -514,14 +522,18 @@ namespace Sintering
     void
     initialize_system_matrix() const
     {
+      const MatrixLayout layout = compute_matrix_layout();
+
       const bool system_matrix_is_empty =
-        system_matrix.m() == 0 || system_matrix.n() == 0;
+        system_matrix.m() == 0 || system_matrix.n() == 0 ||
+        matrix_layout_has_changed(system_matrix_layout, layout);
 
       if (system_matrix_is_empty)
         {
           MyScope scope(this->timer, label + "::matrix::sp", this->do_timing);
 
           system_matrix.clear();
+          system_matrix_layout = layout;
 
           AssertDimension(this->matrix_free.get_dof_handler(dof_index)
                             .get_fe()
@@ -608,6 +620,73 @@ namespace Sintering
       (void)solution;
     }
 
+    /* DoF layout the matrices have been built for: the locally owned DoFs,
+     * the number of changes of the triangulation and the number of
+     * components. The triangulation changes are counted via its any_change
+     * signal, to which the operator connects once the first matrix is built.
+     * On a change, the matrices are released right away so that they do not
+     * occupy memory while the solution is transferred to the new mesh.
+     */
+    struct MatrixLayout
+    {
+      IndexSet     locally_owned_dofs;
+      unsigned int n_tria_changes = numbers::invalid_unsigned_int;
+      unsigned int n_components   = 0;
+
+      bool
+      operator==(const MatrixLayout &other) const
+      {
+        return n_tria_changes == other.n_tria_changes &&
+               n_components == other.n_components &&
+               locally_owned_dofs == other.locally_owned_dofs;
+      }
+    };
+
+    MatrixLayout
+    compute_matrix_layout() const
+    {
+      const auto &dof_handler = this->matrix_free.get_dof_handler(dof_index);
+      const auto &tria        = dof_handler.get_triangulation();
+
+      if (&tria != connected_tria)
+        {
+          tria_connection.disconnect();
+          tria_connection = tria.signals.any_change.connect([this]() {
+            ++n_tria_changes;
+            release_matrices();
+          });
+          connected_tria = &tria;
+        }
+
+      MatrixLayout layout;
+      layout.locally_owned_dofs = dof_handler.locally_owned_dofs();
+      layout.n_tria_changes     = n_tria_changes;
+      layout.n_components       = this->n_components();
+
+      return layout;
+    }
+
+    bool
+    matrix_layout_has_changed(const MatrixLayout &old_layout,
+                              const MatrixLayout &new_layout) const
+    {
+      const bool has_changed = (old_layout == new_layout) == false;
+
+      return Utilities::MPI::max(
+               static_cast<unsigned int>(has_changed),
+               this->matrix_free.get_dof_handler(dof_index)
+                 .get_communicator()) == 1;
+    }
+
+    void
+    release_matrices() const
+    {
+      clear_system_matrix();
+
+      dsp.clear();
+      constraints_for_matrix.clear();
+    }
+
     void
     clear_system_matrix() const
     {
@@ -626,7 +705,11 @@ namespace Sintering
     const std::vector<std::shared_ptr<TrilinosWrappers::SparseMatrix>> &
     get_block_system_matrix() const
     {
-      const bool system_matrix_is_empty = block_system_matrix.size() == 0;
+      const MatrixLayout layout = compute_matrix_layout();
+
+      const bool system_matrix_is_empty =
+        block_system_matrix.size() == 0 ||
+        matrix_layout_has_changed(block_system_matrix_layout, layout);
 
       if (system_matrix_is_empty)
         {
@@ -634,6 +717,9 @@ namespace Sintering
                         this->label + "::block_matrix::sp",
                         this->do_timing);
 
+          block_system_matrix.clear();
+          block_system_matrix_layout = layout;
+
           AssertDimension(this->matrix_free.get_dof_handler(dof_index)
                             .get_fe()
                             .n_components(),
@@ -887,6 +973,13 @@ namespace Sintering
     mutable std::vector<std::shared_ptr<TrilinosWrappers::SparseMatrix>>
       block_system_matrix;
 
+    mutable MatrixLayout system_matrix_layout;
+    mutable MatrixLayout block_system_matrix_layout;
+
+    mutable const Triangulation<dim> *  connected_tria = nullptr;
+    mutable boost::signals2::connection tria_connection;
+    mutable unsigned int                n_tria_changes = 0;
+
     ConditionalOStream    pcout;
     mutable MyTimerOutput timer;
     mutable bool          do_timing;
@@ -32,12 +32,14 @@ namespace Sintering
                           const Number                      kappa_c,
                           const Number                      kappa_p,
                           std::shared_ptr<MobilityProvider> mobility_provider,
-                          const unsigned int                integration_order)
+                          const unsigned int                integration_order,
+                          const bool linearization_on_the_fly = false)
       : free_energy(A, B)
       , kappa_c(kappa_c)
       , kappa_p(kappa_p)
       , time_data(integration_order)
       , mobility(mobility_provider)
+      , linearization_on_the_fly(linearization_on_the_fly)
       , t(0.0)
     {}
 
@@ -52,7 +54,7 @@ namespace Sintering
     bool
     has_additional_variables_attached() const
     {
-      return nonlinear_values.size(2) > 2 + n_grains();
+      return n_components_save_value > 2 + n_grains();
     }
 
     const Table<3, VectorizedArrayType> &
@@ -70,6 +72,16 @@ namespace Sintering
     const VectorizedArrayType *
     get_nonlinear_values(const unsigned int cell) const
     {
+      if (linearization_on_the_fly)
+        {
+          update_linearization_cache(cell);
+
+          if (value_ptr.empty())
+            return values_cache.data();
+          else
+            return values_cache_compressed.data();
+        }
+
       if (value_ptr.empty())
         return &nonlinear_values[cell][0][0];
       else
@@ -79,12 +91,72 @@ namespace Sintering
     const dealii::Tensor<1, dim, VectorizedArrayType> *
     get_nonlinear_gradients(const unsigned int cell) const
     {
+      if (linearization_on_the_fly)
+        {
+          update_linearization_cache(cell);
+
+          if (gradient_ptr.empty())
+            return gradients_cache.data();
+          else
+            return gradients_cache_compressed.data();
+        }
+
       if (gradient_ptr.empty())
         return &nonlinear_gradients[cell][0][0];
       else
         return &nonlinear_gradients_new[gradient_ptr[cell]];
     }
 
+    /**
+     * Values of the linearization point at quadrature point @p q of a cell
+     * batch, indexed by the global component number (irrelevant grains of
+     * the cut-off mode are zero). The returned pointer is valid until the
+     * next cell is requested.
+     */
+    const VectorizedArrayType *
+    get_nonlinear_values_uncompressed(const unsigned int cell,
+                                      const unsigned int q) const
+    {
+      if (linearization_on_the_fly)
+        {
+          update_linearization_cache(cell);
+          return values_cache.data() + q * n_components_save_value;
+        }
+
+      if (value_ptr.empty() == false)
+        {
+          update_uncompressed_cache(cell);
+          return values_cache.data() + q * n_components_save_value;
+        }
+
+      return &nonlinear_values[cell][q][0];
+    }
+
+    const dealii::Tensor<1, dim, VectorizedArrayType> *
+    get_nonlinear_gradients_uncompressed(const unsigned int cell,
+                                         const unsigned int q) const
+    {
+      if (linearization_on_the_fly)
+        {
+          update_linearization_cache(cell);
+          return gradients_cache.data() + q * n_components_save_gradient;
+        }
+
+      if (gradient_ptr.empty() == false)
+        {
+          update_uncompressed_cache(cell);
+          return gradients_cache.data() + q * n_components_save_gradient;
+        }
+
+      return &nonlinear_gradients[cell][q][0];
+    }
+
+    bool
+    linearization_evaluated_on_the_fly() const
+    {
+      return linearization_on_the_fly;
+    }
+
     Table<2, bool> &
     get_component_table() const
     {
@@ -115,7 +187,8 @@ namespace Sintering
       const LinearAlgebra::distributed::DynamicBlockVector<Number> &src,
       const bool   save_op_gradients,
       const bool   save_all_blocks,
-      const double grain_use_cut_off_tolerance)
+      const double grain_use_cut_off_tolerance,
+      const bool   print_statistics = true)
     {
       src.update_ghost_values();
 
@@ -129,7 +202,7 @@ namespace Sintering
       table_lanes.reinit({n_cells, VectorizedArrayType::size()});
 
       for (unsigned int i = 0; i < n_cells; ++i)
-        for (unsigned int j = 0; j < n_grains(); ++j)
+        for (unsigned int j = 0; j < VectorizedArrayType::size(); ++j)
           table_lanes[i][j] = numbers::invalid_unsigned_int;
 
       component_table.reinit({n_cells, n_grains()});
@@ -172,6 +245,7 @@ namespace Sintering
 
       relevant_grains_vector = {};
       relevant_grains_ptr    = {0};
+      max_n_relevant_grains  = 0;
 
       for (unsigned int cell = 0; cell < n_cells; ++cell)
         {
@@ -186,6 +260,8 @@ namespace Sintering
 
           relevant_grains_ptr.push_back(relevant_grains_vector.size());
 
+          max_n_relevant_grains = std::max(max_n_relevant_grains, counter);
+
           const unsigned n_components_save_value =
             (save_all_blocks ? src.n_blocks() : this->n_components()) -
             n_grains() + counter;
@@ -202,6 +278,12 @@ namespace Sintering
                                       n_components_save_gradient);
         }
 
+      if (print_statistics == false)
+        {
+          src.zero_out_ghost_values();
+          return;
+        }
+
       ConditionalOStream pcout(std::cout,
                                Utilities::MPI::this_mpi_process(comm) == 0);
 
@@ -274,91 +356,98 @@ namespace Sintering
       this->history_vector = src;
       this->history_vector.update_ghost_values();
 
-      const unsigned n_cells             = matrix_free.n_cell_batches();
-      const unsigned n_quadrature_points = matrix_free.get_quadrature().size();
+      n_cell_batches      = matrix_free.n_cell_batches();
+      n_quadrature_points = matrix_free.get_quadrature().size();
 
-      const unsigned n_components_save =
+      n_components_save_value =
         save_all_blocks ? src.n_blocks() : this->n_components();
+      n_components_save_gradient =
+        use_tensorial_mobility || save_op_gradients ? n_components_save_value :
+                                                      2;
 
-      nonlinear_values.reinit(
-        {n_cells, n_quadrature_points, n_components_save});
-
-      nonlinear_gradients.reinit(
-        {n_cells,
-         n_quadrature_points,
-         use_tensorial_mobility || save_op_gradients ? n_components_save : 2});
+      if (linearization_on_the_fly)
+        {
+          // Only the history vector is kept. The values and gradients are
+          // recomputed cell by cell when a kernel asks for them.
+          nonlinear_values.reinit({0, 0, 0});
+          nonlinear_gradients.reinit({0, 0, 0});
+          nonlinear_values_new.clear();
+          nonlinear_gradients_new.clear();
+
+          phi_linearization = std::make_shared<
+            FECellIntegrator<dim, 1, Number, VectorizedArrayType>>(
+            matrix_free);
+          cached_cell = numbers::invalid_unsigned_int;
+
+          values_cache.resize(n_quadrature_points * n_components_save_value);
+          gradients_cache.resize(n_quadrature_points *
+                                 n_components_save_gradient);
+
+          if (value_ptr.empty() == false)
+            {
+              values_cache_compressed.resize(values_cache.size());
+              gradients_cache_compressed.resize(gradients_cache.size());
+            }
 
-      if (value_ptr.empty() == false)
-        nonlinear_values_new.resize(value_ptr.back());
+          return;
+        }
 
-      if (gradient_ptr.empty() == false)
-        nonlinear_gradients_new.resize(gradient_ptr.back());
+      phi_linearization.reset();
+      values_cache_compressed.clear();
+      gradients_cache_compressed.clear();
+      cached_cell = numbers::invalid_unsigned_int;
 
       FECellIntegrator<dim, 1, Number, VectorizedArrayType> phi(matrix_free);
 
       src.update_ghost_values();
 
-      for (unsigned int cell = 0; cell < n_cells; ++cell)
+      if (value_ptr.empty() == false)
         {
-          phi.reinit(cell);
-
-          for (unsigned int c = 0; c < n_components_save; ++c)
-            {
-              phi.read_dof_values_plain(src.block(c));
-              phi.evaluate(EvaluationFlags::values |
-                           EvaluationFlags::gradients);
-
-              for (unsigned int q = 0; q < phi.n_q_points; ++q)
-                {
-                  auto value    = phi.get_value(q);
-                  auto gradient = phi.get_gradient(q);
+          // With the cut-off only the compressed tables are kept: each cell
+          // batch is evaluated into a scratch buffer and compressed from
+          // there. The same buffer serves the uncompressed getters later.
+          nonlinear_values.reinit({0, 0, 0});
+          nonlinear_gradients.reinit({0, 0, 0});
 
-                  if ((component_table.size(0) > 0) && (c >= 2))
-                    if (component_table[cell][c - 2] == false)
-                      {
-                        value    = VectorizedArrayType();
-                        gradient = Tensor<1, dim, VectorizedArrayType>();
-                      }
+          nonlinear_values_new.resize(value_ptr.back());
+          nonlinear_gradients_new.resize(gradient_ptr.back());
 
-                  nonlinear_values(cell, q, c) = value;
-
-                  if (use_tensorial_mobility || (c < 2) || save_op_gradients)
-                    nonlinear_gradients(cell, q, c) = gradient;
-                }
-            }
+          values_cache.resize(n_quadrature_points * n_components_save_value);
+          gradients_cache.resize(n_quadrature_points *
+                                 n_components_save_gradient);
 
-          if (component_table.size(0) > 0)
+          for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
             {
-              const unsigned n_components_save_value =
-                save_all_blocks ? src.n_blocks() : this->n_components();
-
-              const unsigned n_components_save_gradient =
-                use_tensorial_mobility || save_op_gradients ?
-                  n_components_save_value :
-                  2;
-
-              unsigned int counter_v = value_ptr[cell];
-              unsigned int counter_g = gradient_ptr[cell];
-
-              for (unsigned int q = 0; q < n_quadrature_points; ++q)
-                {
-                  for (unsigned int c = 0; c < n_components_save_value; ++c)
-                    if (((c < 2) || (c >= (2 + n_grains()))) ||
-                        component_table[cell][c - 2])
-                      nonlinear_values_new[counter_v++] =
-                        nonlinear_values(cell, q, c);
-
-                  for (unsigned int c = 0; c < n_components_save_gradient; ++c)
-                    if (((c < 2) || (c >= (2 + n_grains()))) ||
-                        component_table[cell][c - 2])
-                      nonlinear_gradients_new[counter_g++] =
-                        nonlinear_gradients(cell, q, c);
-                }
-
-              AssertDimension(counter_v, value_ptr[cell + 1]);
-              AssertDimension(counter_g, gradient_ptr[cell + 1]);
+              evaluate_linearization_point(
+                phi, src, cell, values_cache.data(), gradients_cache.data());
+
+              compress_linearization_point(
+                cell,
+                values_cache.data(),
+                gradients_cache.data(),
+                &nonlinear_values_new[value_ptr[cell]],
+                &nonlinear_gradients_new[gradient_ptr[cell]]);
             }
         }
+      else
+        {
+          values_cache.clear();
+          gradients_cache.clear();
+          nonlinear_values_new.clear();
+          nonlinear_gradients_new.clear();
+
+          nonlinear_values.reinit(
+            {n_cell_batches, n_quadrature_points, n_components_save_value});
+          nonlinear_gradients.reinit(
+            {n_cell_batches, n_quadrature_points, n_components_save_gradient});
+
+          for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+            evaluate_linearization_point(phi,
+                                         src,
+                                         cell,
+                                         &nonlinear_values[cell][0][0],
+                                         &nonlinear_gradients[cell][0][0]);
+        }
 
       src.zero_out_ghost_values();
     }
@@ -367,7 +456,40 @@ namespace Sintering
     memory_consumption() const
     {
       return nonlinear_values.memory_consumption() +
-             nonlinear_gradients.memory_consumption();
+             nonlinear_gradients.memory_consumption() +
+             nonlinear_values_new.memory_consumption() +
+             nonlinear_gradients_new.memory_consumption() +
+             values_cache.memory_consumption() +
+             gradients_cache.memory_consumption() +
+             values_cache_compressed.memory_consumption() +
+             gradients_cache_compressed.memory_consumption();
+    }
+
+    /**
+     * Estimate of the memory that the quadrature point tables would occupy
+     * and that is not allocated if the linearization point is evaluated on
+     * the fly.
+     */
+    std::size_t
+    memory_consumption_saved() const
+    {
+      if (linearization_on_the_fly == false)
+        return 0;
+
+      if (value_ptr.empty() == false)
+        return value_ptr.back() * sizeof(VectorizedArrayType) +
+               gradient_ptr.back() *
+                 sizeof(Tensor<1, dim, VectorizedArrayType>);
+
+      const std::size_t n_values =
+        std::size_t(n_cell_batches) * n_quadrature_points *
+        n_components_save_value;
+      const std::size_t n_gradients =
+        std::size_t(n_cell_batches) * n_quadrature_points *
+        n_components_save_gradient;
+
+      return n_values * sizeof(VectorizedArrayType) +
+             n_gradients * sizeof(Tensor<1, dim, VectorizedArrayType>);
     }
 
     const LinearAlgebra::distributed::DynamicBlockVector<Number> &
@@ -395,13 +517,24 @@ namespace Sintering
       return mobility;
     }
 
-    ArrayView<const unsigned char>
+    ArrayView<const unsigned int>
     get_relevant_grains(const unsigned int cell) const
     {
-      return ArrayView<const unsigned char>(relevant_grains_vector.data() +
-                                              relevant_grains_ptr[cell],
-                                            relevant_grains_ptr[cell + 1] -
-                                              relevant_grains_ptr[cell]);
+      return ArrayView<const unsigned int>(relevant_grains_vector.data() +
+                                             relevant_grains_ptr[cell],
+                                           relevant_grains_ptr[cell + 1] -
+                                             relevant_grains_ptr[cell]);
+    }
+
+    /**
+     * Maximum number of grains active in a cell batch of this process. The
+     * kernels of the cut-off mode are templated on this number rather than on
+     * the global number of order parameters.
+     */
+    unsigned int
+    n_max_relevant_grains() const
+    {
+      return cut_off_enabled() ? max_n_relevant_grains : n_grains();
     }
 
     std::vector<unsigned char>
@@ -433,6 +566,138 @@ namespace Sintering
     }
 
   private:
+    void
+    evaluate_linearization_point(
+      FECellIntegrator<dim, 1, Number, VectorizedArrayType> &       phi,
+      const LinearAlgebra::distributed::DynamicBlockVector<Number> &src,
+      const unsigned int                                            cell,
+      VectorizedArrayType *                                         values,
+      Tensor<1, dim, VectorizedArrayType> *gradients) const
+    {
+      phi.reinit(cell);
+
+      for (unsigned int c = 0; c < n_components_save_value; ++c)
+        {
+          const bool save_gradient = c < n_components_save_gradient;
+
+          // grains cut off on this cell batch are not evaluated at all
+          if ((component_table.size(0) > 0) && (c >= 2) &&
+              (c < 2 + n_grains()) && (component_table[cell][c - 2] == false))
+            {
+              for (unsigned int q = 0; q < phi.n_q_points; ++q)
+                {
+                  values[q * n_components_save_value + c] =
+                    VectorizedArrayType();
+
+                  if (save_gradient)
+                    gradients[q * n_components_save_gradient + c] =
+                      Tensor<1, dim, VectorizedArrayType>();
+                }
+
+              continue;
+            }
+
+          phi.read_dof_values_plain(src.block(c));
+          phi.evaluate(save_gradient ? (EvaluationFlags::values |
+                                        EvaluationFlags::gradients) :
+                                       EvaluationFlags::values);
+
+          for (unsigned int q = 0; q < phi.n_q_points; ++q)
+            {
+              values[q * n_components_save_value + c] = phi.get_value(q);
+
+              if (save_gradient)
+                gradients[q * n_components_save_gradient + c] =
+                  phi.get_gradient(q);
+            }
+        }
+    }
+
+    void
+    compress_linearization_point(
+      const unsigned int                         cell,
+      const VectorizedArrayType *                values,
+      const Tensor<1, dim, VectorizedArrayType> *gradients,
+      VectorizedArrayType *                      values_compressed,
+      Tensor<1, dim, VectorizedArrayType> *      gradients_compressed) const
+    {
+      unsigned int counter_v = 0;
+      unsigned int counter_g = 0;
+
+      for (unsigned int q = 0; q < n_quadrature_points; ++q)
+        {
+          for (unsigned int c = 0; c < n_components_save_value; ++c)
+            if (((c < 2) || (c >= (2 + n_grains()))) ||
+                component_table[cell][c - 2])
+              values_compressed[counter_v++] =
+                values[q * n_components_save_value + c];
+
+          for (unsigned int c = 0; c < n_components_save_gradient; ++c)
+            if (((c < 2) || (c >= (2 + n_grains()))) ||
+                component_table[cell][c - 2])
+              gradients_compressed[counter_g++] =
+                gradients[q * n_components_save_gradient + c];
+        }
+
+      AssertDimension(counter_v, value_ptr[cell + 1] - value_ptr[cell]);
+      AssertDimension(counter_g, gradient_ptr[cell + 1] - gradient_ptr[cell]);
+    }
+
+    void
+    update_uncompressed_cache(const unsigned int cell) const
+    {
+      if (cell == cached_cell)
+        return;
+
+      const VectorizedArrayType *values_compressed =
+        &nonlinear_values_new[value_ptr[cell]];
+      const Tensor<1, dim, VectorizedArrayType> *gradients_compressed =
+        &nonlinear_gradients_new[gradient_ptr[cell]];
+
+      for (unsigned int q = 0; q < n_quadrature_points; ++q)
+        {
+          for (unsigned int c = 0; c < n_components_save_value; ++c)
+            values_cache[q * n_components_save_value + c] =
+              (((c < 2) || (c >= (2 + n_grains()))) ||
+               component_table[cell][c - 2]) ?
+                *(values_compressed++) :
+                VectorizedArrayType();
+
+          for (unsigned int c = 0; c < n_components_save_gradient; ++c)
+            gradients_cache[q * n_components_save_gradient + c] =
+              (((c < 2) || (c >= (2 + n_grains()))) ||
+               component_table[cell][c - 2]) ?
+                *(gradients_compressed++) :
+                Tensor<1, dim, VectorizedArrayType>();
+        }
+
+      cached_cell = cell;
+    }
+
+    void
+    update_linearization_cache(const unsigned int cell) const
+    {
+      if (cell == cached_cell)
+        return;
+
+      Assert(phi_linearization, ExcNotInitialized());
+
+      evaluate_linearization_point(*phi_linearization,
+                                   history_vector,
+                                   cell,
+                                   values_cache.data(),
+                                   gradients_cache.data());
+
+      if (value_ptr.empty() == false)
+        compress_linearization_point(cell,
+                                     values_cache.data(),
+                                     gradients_cache.data(),
+                                     values_cache_compressed.data(),
+                                     gradients_cache_compressed.data());
+
+      cached_cell = cell;
+    }
+
     MobilityType mobility;
 
     mutable Table<3, VectorizedArrayType> nonlinear_values;
@@ -446,13 +711,33 @@ namespace Sintering
     std::vector<unsigned int> value_ptr;
     std::vector<unsigned int> gradient_ptr;
 
-    std::vector<unsigned char> relevant_grains_vector;
-    std::vector<unsigned int>  relevant_grains_ptr;
+    std::vector<unsigned int> relevant_grains_vector;
+    std::vector<unsigned int> relevant_grains_ptr;
+    unsigned int              max_n_relevant_grains = 0;
 
     mutable Table<2, bool> component_table;
 
     unsigned int number_of_components;
 
+    unsigned int n_cell_batches             = 0;
+    unsigned int n_quadrature_points        = 0;
+    unsigned int n_components_save_value    = 0;
+    unsigned int n_components_save_gradient = 0;
+
+    bool linearization_on_the_fly;
+
+    mutable std::shared_ptr<
+      FECellIntegrator<dim, 1, Number, VectorizedArrayType>>
+                         phi_linearization;
+    mutable unsigned int cached_cell = numbers::invalid_unsigned_int;
+
+    mutable AlignedVector<VectorizedArrayType> values_cache;
+    mutable AlignedVector<dealii::Tensor<1, dim, VectorizedArrayType>>
+      gradients_cache;
+    mutable AlignedVector<VectorizedArrayType> values_cache_compressed;
+    mutable AlignedVector<dealii::Tensor<1, dim, VectorizedArrayType>>
+      gradients_cache_compressed;
+
     LinearAlgebra::distributed::DynamicBlockVector<Number> history_vector;
 
     double t;
@@ -319,7 +319,7 @@ namespace Sintering
     {
       std::vector<
         std::shared_ptr<FEEvaluationData<dim, VectorizedArrayType, false>>>
-        phis(this->n_grains() + 1);
+        phis(this->data.n_max_relevant_grains() + 1);
 
       AlignedVector<VectorizedArrayType> gradient_buffer;
 
@@ -333,7 +333,7 @@ namespace Sintering
               static_n_q_points);
         }
 
-      for (unsigned int i = 0; i <= this->n_grains(); ++i)
+      for (unsigned int i = 0; i < phis.size(); ++i)
         {
           const unsigned int n_comp_nt = i + 2;
 #define OPERATION(n_comp, dummy)                                 \
@@ -641,38 +641,63 @@ namespace Sintering
     do_evalute_history(
       FECellIntegratorType &              phi,
       AlignedVector<VectorizedArrayType> &buffer,
-      const std::vector<unsigned char> &  vector_indices = {}) const
+      const std::vector<unsigned int> &   vector_indices = {}) const
     {
       if (with_time_derivative == 2)
         {
-          const auto &order         = this->data.time_data.get_order();
-          const auto &weights       = this->data.time_data.get_weights();
-          const auto  old_solutions = this->history.get_old_solutions();
+          const auto &order   = this->data.time_data.get_order();
+          const auto &weights = this->data.time_data.get_weights();
 
           buffer.resize_fast(
             std::max(phi.dofs_per_cell, n_comp * phi.n_q_points));
 
           std::vector<const VectorType *> view;
 
-          for (unsigned int i = 0; i < order; ++i)
+          // weighted sum of the old solutions, precombined once per time step
+          if (this->history.use_precombined_old_solutions())
             {
+              const auto &old_solution =
+                this->history.get_precombined_old_solutions(weights);
+
               if (vector_indices.size() == 0)
-                phi.read_dof_values_plain(*old_solutions[i]);
+                phi.read_dof_values_plain(old_solution);
               else
                 {
                   view.resize(vector_indices.size());
 
                   for (unsigned int j = 0; j < view.size(); ++j)
-                    view[j] = &old_solutions[i]->block(vector_indices[j]);
+                    view[j] = &old_solution.block(vector_indices[j]);
 
                   phi.read_dof_values_plain(view);
                 }
 
               for (unsigned int j = 0; j < phi.dofs_per_cell; ++j)
-                if (i == 0)
-                  buffer[j] = phi.begin_dof_values()[j] * weights[i + 1];
-                else
-                  buffer[j] += phi.begin_dof_values()[j] * weights[i + 1];
+                buffer[j] = phi.begin_dof_values()[j];
+            }
+          else
+            {
+              const auto old_solutions = this->history.get_old_solutions();
+
+              for (unsigned int i = 0; i < order; ++i)
+                {
+                  if (vector_indices.size() == 0)
+                    phi.read_dof_values_plain(*old_solutions[i]);
+                  else
+                    {
+                      view.resize(vector_indices.size());
+
+                      for (unsigned int j = 0; j < view.size(); ++j)
+                        view[j] = &old_solutions[i]->block(vector_indices[j]);
+
+                      phi.read_dof_values_plain(view);
+                    }
+
+                  for (unsigned int j = 0; j < phi.dofs_per_cell; ++j)
+                    if (i == 0)
+                      buffer[j] = phi.begin_dof_values()[j] * weights[i + 1];
+                    else
+                      buffer[j] += phi.begin_dof_values()[j] * weights[i + 1];
+                }
             }
 
           phi.evaluate(buffer.data(), EvaluationFlags::EvaluationFlags::values);
@@ -725,9 +750,9 @@ namespace Sintering
     {
       std::vector<
         std::shared_ptr<FEEvaluationData<dim, VectorizedArrayType, false>>>
-        phis(this->n_grains() + 1);
+        phis(this->data.n_max_relevant_grains() + 1);
 
-      for (unsigned int i = 0; i <= this->n_grains(); ++i)
+      for (unsigned int i = 0; i < phis.size(); ++i)
         {
           const unsigned int n_comp_nt = i + 2;
 #define OPERATION(n_comp, dummy)                                 \
@@ -740,7 +765,7 @@ namespace Sintering
         }
 
       AlignedVector<VectorizedArrayType> buffer;
-      std::vector<unsigned char>         vector_indices;
+      std::vector<unsigned int>          vector_indices;
       std::vector<const VectorType *>    src_view;
       std::vector<VectorType *>          dst_view;
 
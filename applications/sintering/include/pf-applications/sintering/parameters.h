@@ -49,6 +49,7 @@ namespace Sintering
     DivisionsData   divisions_data;
 
     double hanging_node_weight = 1.0;
+    double grain_weight        = 0.0;
   };
 
   struct AdaptivityData
@@ -64,6 +65,8 @@ namespace Sintering
 
     bool   quality_control = false;
     double quality_min     = 0.5;
+
+    bool init_refinement_from_geometry = false;
   };
 
   struct GrainTrackerData
@@ -76,6 +79,7 @@ namespace Sintering
 
     bool fast_reassignment  = false;
     bool track_with_quality = false;
+    bool incremental        = false;
   };
 
   struct EnergyAbstractData
@@ -157,6 +161,8 @@ namespace Sintering
     double mr  = 1.;
     double cgb = 0.1;
     double ceq = 1.;
+
+    bool print_forces = true;
   };
 
   struct BoundaryConditionsData
@@ -180,6 +186,7 @@ namespace Sintering
     unsigned int desirable_linear_iterations = 100;
     bool         sanity_check_predictor      = false;
     bool         sanity_check_solution       = false;
+    bool         precombine_history          = false;
   };
 
   struct OutputData
@@ -278,11 +285,18 @@ namespace Sintering
     unsigned int newton_threshold_linear_iter = 20;
     bool         newton_reuse_preconditioner  = true;
     bool         newton_use_damping           = true;
+    std::string  newton_update_policy         = "Threshold";
+
+    std::string forcing_term       = "Constant";
+    double      forcing_term_max   = 0.9;
+    double      forcing_term_gamma = 0.9;
+    double      forcing_term_alpha = 2.0;
 
     std::string nonlinear_solver_type = "damped";
 
     bool fdm_jacobian_approximation = false;
     bool jacobi_free                = false;
+    bool jacobian_mixed_precision   = false;
 
     unsigned int verbosity = 1;
 
@@ -308,9 +322,12 @@ namespace Sintering
     ProfilingData          profiling_data;
     NonLinearData          nonlinear_data;
 
-    bool   matrix_based                               = false;
-    double grain_cut_off_tolerance                    = 0.0; // 0.00001
-    bool   use_tensorial_mobility_gradient_on_the_fly = false;
+    bool         matrix_based                               = false;
+    double       grain_cut_off_tolerance                    = 0.0; // 0.00001
+    unsigned int grain_cut_off_max_order_parameters         = 1000;
+    bool         use_tensorial_mobility_gradient_on_the_fly = false;
+    bool         use_linearization_on_the_fly               = false;
+    bool         fused_block_communication                  = false;
 
     bool print_time_loop = true;
 
@@ -360,6 +377,18 @@ namespace Sintering
 #endif
     }
 
+    unsigned int
+    max_order_parameters(const unsigned int max_precompiled_grains) const
+    {
+      // With the grain cut-off, the nonlinear operator is instantiated for the
+      // number of grains active in a cell batch and not for the total number
+      // of order parameters
+      return grain_cut_off_tolerance != 0.0 ?
+               std::max(grain_cut_off_max_order_parameters,
+                        max_precompiled_grains) :
+               max_precompiled_grains;
+    }
+
     void
     print_help()
     {
@@ -396,9 +425,24 @@ namespace Sintering
       prm.add_parameter("GrainCutOffTolerance",
                         grain_cut_off_tolerance,
                         "Grain cut-off tolerance.");
+      prm.add_parameter(
+        "GrainCutOffMaxOrderParameters",
+        grain_cut_off_max_order_parameters,
+        "Maximum number of order parameters if the grain cut-off is enabled.");
       prm.add_parameter("TensorialMobilityGradientOnTheFly",
                         use_tensorial_mobility_gradient_on_the_fly,
                         "Run program matrix-based or matrix-free.");
+      prm.add_parameter(
+        "LinearizationOnTheFly",
+        use_linearization_on_the_fly,
+        "Evaluate the linearization point from the history vector instead of "
+        "storing its values and gradients at all quadrature points.");
+      prm.add_parameter(
+        "FusedBlockCommunication",
+        fused_block_communication,
+        "Exchange the ghost values of all blocks of a vector in a single "
+        "message per neighbor and perform a single reduction for norms and "
+        "dot products.");
 
       prm.enter_subsection("Approximation");
       prm.add_parameter("FEDegree",
@@ -479,6 +523,11 @@ namespace Sintering
       prm.add_parameter("HangingNodeWeight",
                         geometry_data.hanging_node_weight,
                         "Factor to weight cells with hanging nodes with.");
+      prm.add_parameter(
+        "GrainWeight",
+        geometry_data.grain_weight,
+        "Additional weight of a cell per active order parameter "
+        "(only used with grain cut-off, 0 = cells are weighted equally).");
 
       prm.leave_subsection();
 
@@ -514,6 +563,11 @@ namespace Sintering
       prm.add_parameter("InterfaceValueMax",
                         adaptivity_data.interface_val_max,
                         "Maximum value at the interface.");
+      prm.add_parameter(
+        "InitRefinementFromGeometry",
+        adaptivity_data.init_refinement_from_geometry,
+        "Build the initial mesh by refining at the interfaces of the "
+        "initial geometry before setting up the solution.");
       prm.leave_subsection();
 
 
@@ -540,6 +594,10 @@ namespace Sintering
         "TrackWithQuality",
         grain_tracker_data.track_with_quality,
         "Run grain tracker if the mesh refinement is triggered by the quality control.");
+      prm.add_parameter(
+        "Incremental",
+        grain_tracker_data.incremental,
+        "Relabel only the cells that have changed since the last tracking.");
       prm.leave_subsection();
 
 
@@ -667,6 +725,10 @@ namespace Sintering
       prm.add_parameter("Ceq",
                         advection_data.ceq,
                         "Grain boundary equilibrium concentration.");
+      prm.add_parameter("PrintForces",
+                        advection_data.print_forces,
+                        "Print the volumes, forces and torques of the grain "
+                        "segments after each converged step.");
       prm.leave_subsection();
 
 
@@ -713,6 +775,11 @@ namespace Sintering
       prm.add_parameter("DesirableLinearIterations",
                         time_integration_data.desirable_linear_iterations,
                         "Desirable linear iterations.");
+      prm.add_parameter(
+        "PrecombineHistory",
+        time_integration_data.precombine_history,
+        "Build the weighted sum of the old solutions once per time step "
+        "instead of combining them in every residual evaluation.");
       prm.add_parameter("SanityCheckPredictor",
                         time_integration_data.sanity_check_predictor,
                         "Whether to perform PF sanity check after predictor.");
@@ -840,7 +907,9 @@ namespace Sintering
       prm.add_parameter("LinearSolver",
                         nonlinear_data.l_solver,
                         "Name of linear solver.",
-                        Patterns::Selection("GMRES|IDR|Bicgstab|Relaxation"));
+                        Patterns::Selection(
+                          "GMRES|GCRODR|PipelinedGMRES|IDR|Bicgstab|"
+                          "Relaxation"));
       prm.add_parameter("LinearSolverBicgstabTries",
                         nonlinear_data.l_bisgstab_tries,
                         "Number of Bicgstab before switching to GMRES.");
@@ -852,6 +921,30 @@ namespace Sintering
       prm.add_parameter("NewtonReusePreconditioner",
                         nonlinear_data.newton_reuse_preconditioner);
       prm.add_parameter("NewtonUseDamping", nonlinear_data.newton_use_damping);
+      prm.add_parameter(
+        "NewtonUpdatePolicy",
+        nonlinear_data.newton_update_policy,
+        "Policy to update the preconditioner: based on the thresholds "
+        "(Threshold) or on the setup time and the increase of the number of "
+        "linear iterations (CostModel).",
+        Patterns::Selection("Threshold|CostModel"));
+
+      prm.add_parameter(
+        "ForcingTerm",
+        nonlinear_data.forcing_term,
+        "Relative tolerance of the linear solver within the damped Newton "
+        "solver: constant (LinearRelativeTolerance) or Eisenstat-Walker "
+        "choice 1 or 2.",
+        Patterns::Selection("Constant|EisenstatWalker1|EisenstatWalker2"));
+      prm.add_parameter("ForcingTermMax",
+                        nonlinear_data.forcing_term_max,
+                        "Upper bound of the adaptive forcing term.");
+      prm.add_parameter("ForcingTermGamma",
+                        nonlinear_data.forcing_term_gamma,
+                        "Parameter gamma of Eisenstat-Walker choice 2.");
+      prm.add_parameter("ForcingTermAlpha",
+                        nonlinear_data.forcing_term_alpha,
+                        "Parameter alpha of Eisenstat-Walker choice 2.");
 
       prm.add_parameter("NonLinearSolverType",
                         nonlinear_data.nonlinear_solver_type,
@@ -861,6 +954,11 @@ namespace Sintering
       prm.add_parameter("FDMJacobianApproximation",
                         nonlinear_data.fdm_jacobian_approximation);
       prm.add_parameter("JacobiFree", nonlinear_data.jacobi_free);
+      prm.add_parameter(
+        "JacobianMixedPrecision",
+        nonlinear_data.jacobian_mixed_precision,
+        "Apply the matrix-free Jacobian within the linear solver in single "
+        "precision.");
       prm.add_parameter("Verbosity", nonlinear_data.verbosity);
 
       prm.enter_subsection("NOXData");
@@ -903,7 +1001,12 @@ namespace Sintering
                         nonlinear_data.gmres_data.orthogonalization_strategy,
                         "Orthogonalization strategy",
                         Patterns::Selection(
-                          "classical gram schmidt|modified gram schmidt"));
+                          "classical gram schmidt|modified gram schmidt|"
+                          "fused classical gram schmidt"));
+      prm.add_parameter(
+        "RecyclingDimension",
+        nonlinear_data.gmres_data.recycling_dimension,
+        "Number of vectors recycled across linear solves by GCRODR.");
       prm.leave_subsection();
 
       prm.leave_subsection();
@@ -938,6 +1041,11 @@ namespace Sintering
         preconditioners_data.block_preconditioner_2_data.block_2_preconditioner,
         "Preconditioner to be used for the first block.",
         Patterns::Selection(preconditioner_types));
+      prm.add_parameter(
+        "ReuseAMGHierarchy",
+        preconditioners_data.block_preconditioner_2_data.reuse_amg_hierarchy,
+        "Keep the aggregates of the AMG preconditioners of the blocks until "
+        "the mesh or the number of components changes.");
 
       prm.enter_subsection("Block2AMG");
       prm.add_parameter("SmootherSweeps",
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <deal.II/base/exceptions.h>
+
+#include <pf-applications/sintering/particle.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Sintering
+{
+  using namespace dealii;
+
+  /* A particle cloud together with optionally precomputed contacts and
+   * coloring (order parameter of each particle).
+   */
+  template <int dim>
+  struct ParticleCloud
+  {
+    std::vector<Particle<dim>> particles;
+
+    // Pairs of overlapping particles (i < j)
+    bool                                               has_contacts = false;
+    std::vector<std::pair<unsigned int, unsigned int>> contacts;
+
+    // Coloring and the interface parameters it has been computed for
+    std::vector<unsigned int> colors;
+    double                    interface_width        = 0.0;
+    double                    interface_buffer_ratio = 0.0;
+
+    bool
+    has_colors_for(const double interface_width,
+                   const double interface_buffer_ratio) const
+    {
+      return colors.size() == particles.size() && !colors.empty() &&
+             this->interface_width == interface_width &&
+             this->interface_buffer_ratio == interface_buffer_ratio;
+    }
+  };
+
+  namespace internal
+  {
+    /* Layout of a binary cloud file (native endianness):
+     *  - header
+     *  - center and radius of each particle: double[n_particles][dim + 1]
+     *  - contacts: uint32[n_contacts][2]
+     *  - colors (if has_colors): uint32[n_particles]
+     */
+    struct BinaryCloudHeader
+    {
+      char          magic[8];
+      std::uint32_t version;
+      std::uint32_t dim;
+      std::uint64_t n_particles;
+      std::uint64_t n_contacts;
+      std::uint32_t has_contacts;
+      std::uint32_t has_colors;
+      double        interface_width;
+      double        interface_buffer_ratio;
+    };
+
+    static_assert(sizeof(BinaryCloudHeader) == 56,
+                  "Unexpected padding in the binary cloud header");
+
+    static constexpr char          binary_cloud_magic[8] = "PFCLOUD";
+    static constexpr std::uint32_t binary_cloud_version  = 1;
+  } // namespace internal
+
+  inline bool
+  is_binary_cloud(const std::string &file_name)
+  {
+    std::ifstream stream(file_name, std::ios::binary);
+
+    char magic[sizeof(internal::binary_cloud_magic)] = {};
+    stream.read(magic, sizeof(magic));
+
+    return stream.good() && std::memcmp(magic,
+                                        internal::binary_cloud_magic,
+                                        sizeof(magic)) == 0;
+  }
+
+  template <int dim>
+  void
+  write_binary_cloud(const std::string &       file_name,
+                     const ParticleCloud<dim> &cloud)
+  {
+    internal::BinaryCloudHeader header;
+    std::memcpy(header.magic,
+                internal::binary_cloud_magic,
+                sizeof(header.magic));
+    header.version                = internal::binary_cloud_version;
+    header.dim                    = dim;
+    header.n_particles            = cloud.particles.size();
+    header.n_contacts             = cloud.contacts.size();
+    header.has_contacts           = cloud.has_contacts;
+    header.has_colors             = !cloud.colors.empty();
+    header.interface_width        = cloud.interface_width;
+    header.interface_buffer_ratio = cloud.interface_buffer_ratio;
+
+    AssertThrow(cloud.colors.empty() ||
+                  cloud.colors.size() == cloud.particles.size(),
+                ExcMessage("A color has to be provided for each particle"));
+
+    std::vector<double> particles_data;
+    particles_data.reserve(cloud.particles.size() * (dim + 1));
+    for (const auto &particle : cloud.particles)
+      {
+        for (unsigned int d = 0; d < dim; ++d)
+          particles_data.push_back(particle.center[d]);
+        particles_data.push_back(particle.radius);
+      }
+
+    std::vector<std::uint32_t> contacts_data;
+    contacts_data.reserve(2 * cloud.contacts.size());
+    for (const auto &[i, j] : cloud.contacts)
+      {
+        contacts_data.push_back(i);
+        contacts_data.push_back(j);
+      }
+
+    const std::vector<std::uint32_t> colors_data(cloud.colors.begin(),
+                                                 cloud.colors.end());
+
+    std::ofstream stream(file_name, std::ios::binary);
+    AssertThrow(stream.is_open(),
+                ExcMessage("Could not open " + file_name + " for writing"));
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char *>(particles_data.data()),
+                 particles_data.size() * sizeof(double));
+    stream.write(reinterpret_cast<const char *>(contacts_data.data()),
+                 contacts_data.size() * sizeof(std::uint32_t));
+    stream.write(reinterpret_cast<const char *>(colors_data.data()),
+                 colors_data.size() * sizeof(std::uint32_t));
+
+    AssertThrow(stream.good(), ExcMessage("Failed to write " + file_name));
+  }
+
+  /* Read a binary cloud file. The file is mapped into memory, so that
+   * processes on the same node share the pages of the file cache.
+   */
+  template <int dim>
+  ParticleCloud<dim>
+  read_binary_cloud(const std::string &file_name)
+  {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    AssertThrow(fd != -1, ExcMessage("Could not open " + file_name));
+
+    struct stat file_stat;
+    AssertThrow(fstat(fd, &file_stat) == 0,
+                ExcMessage("Could not determine the size of " + file_name));
+
+    const std::size_t file_size = file_stat.st_size;
+
+    AssertThrow(file_size >= sizeof(internal::BinaryCloudHeader),
+                ExcMessage(file_name + " is not a binary cloud file"));
+
+    void *data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    AssertThrow(data != MAP_FAILED,
+                ExcMessage("Could not map " + file_name + " into memory"));
+
+    const char *ptr = static_cast<const char *>(data);
+
+    internal::BinaryCloudHeader header;
+    std::memcpy(&header, ptr, sizeof(header));
+    ptr += sizeof(header);
+
+    const auto check = [&](const bool condition, const std::string &message) {
+      if (condition == false)
+        munmap(data, file_size);
+
+      AssertThrow(condition, ExcMessage(file_name + ": " + message));
+    };
+
+    check(std::memcmp(header.magic,
+                      internal::binary_cloud_magic,
+                      sizeof(header.magic)) == 0,
+          "not a binary cloud file");
+    check(header.version == internal::binary_cloud_version,
+          "unsupported version " + std::to_string(header.version));
+    check(header.dim == dim,
+          "the cloud is " + std::to_string(header.dim) +
+            "D, but the simulation is " + std::to_string(dim) + "D");
+
+    const std::size_t expected_size =
+      sizeof(header) + header.n_particles * (dim + 1) * sizeof(double) +
+      header.n_contacts * 2 * sizeof(std::uint32_t) +
+      (header.has_colors ? header.n_particles * sizeof(std::uint32_t) : 0);
+
+    check(file_size == expected_size, "unexpected file size");
+
+    ParticleCloud<dim> cloud;
+
+    const double *particles_data = reinterpret_cast<const double *>(ptr);
+    ptr += header.n_particles * (dim + 1) * sizeof(double);
+
+    cloud.particles.resize(header.n_particles);
+    for (unsigned int i = 0; i < header.n_particles; ++i)
+      {
+        auto &particle = cloud.particles[i];
+
+        for (unsigned int d = 0; d < dim; ++d)
+          particle.center[d] = particles_data[i * (dim + 1) + d];
+        particle.radius = particles_data[i * (dim + 1) + dim];
+        particle.id     = i;
+      }
+
+    const std::uint32_t *contacts_data =
+      reinterpret_cast<const std::uint32_t *>(ptr);
+    ptr += header.n_contacts * 2 * sizeof(std::uint32_t);
+
+    cloud.has_contacts = header.has_contacts;
+    cloud.contacts.resize(header.n_contacts);
+    for (unsigned int i = 0; i < header.n_contacts; ++i)
+      cloud.contacts[i] = {contacts_data[2 * i], contacts_data[2 * i + 1]};
+
+    if (header.has_colors)
+      {
+        const std::uint32_t *colors_data =
+          reinterpret_cast<const std::uint32_t *>(ptr);
+
+        cloud.colors.assign(colors_data, colors_data + header.n_particles);
+        cloud.interface_width        = header.interface_width;
+        cloud.interface_buffer_ratio = header.interface_buffer_ratio;
+      }
+
+    munmap(data, file_size);
+
+    for (const auto &[i, j] : cloud.contacts)
+      AssertThrow(i < cloud.particles.size() && j < cloud.particles.size(),
+                  ExcMessage(file_name + ": invalid contact"));
+
+    // the colors are used as order parameters, hence, they have to be
+    // numbered contiguously and particles in contact must not share one
+    if (cloud.colors.empty() == false)
+      {
+        const std::size_t n_colors =
+          std::size_t(
+            *std::max_element(cloud.colors.begin(), cloud.colors.end())) +
+          1;
+
+        AssertThrow(n_colors <= cloud.particles.size(),
+                    ExcMessage(file_name + ": there are more colors than "
+                                           "particles"));
+
+        std::vector<bool> color_is_used(n_colors, false);
+        for (const auto color : cloud.colors)
+          color_is_used[color] = true;
+
+        for (std::size_t c = 0; c < n_colors; ++c)
+          AssertThrow(color_is_used[c],
+                      ExcMessage(file_name + ": color " + std::to_string(c) +
+                                 " is not used, the colors have to be "
+                                 "numbered contiguously"));
+
+        for (const auto &[i, j] : cloud.contacts)
+          AssertThrow(cloud.colors[i] != cloud.colors[j],
+                      ExcMessage(file_name + ": particles " +
+                                 std::to_string(i) + " and " +
+                                 std::to_string(j) +
+                                 " are in contact but share the color " +
+                                 std::to_string(cloud.colors[i])));
+      }
+
+    return cloud;
+  }
+
+  /* Read a particle cloud either from a binary or from a text (CSV) file. */
+  template <int dim>
+  ParticleCloud<dim>
+  read_particle_cloud(const std::string &file_name)
+  {
+    if (is_binary_cloud(file_name))
+      return read_binary_cloud<dim>(file_name);
+
+    std::ifstream stream(file_name);
+    AssertThrow(stream.is_open(), ExcMessage("File not found!"));
+
+    ParticleCloud<dim> cloud;
+    cloud.particles = read_particles<dim>(stream);
+
+    return cloud;
+  }
+} // namespace Sintering
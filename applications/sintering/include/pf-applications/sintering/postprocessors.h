@@ -938,71 +938,6 @@ namespace Sintering
 
 
 
-    namespace internal
-    {
-      template <int dim, typename BlockVectorType, typename Number>
-      unsigned int
-      run_flooding(const typename DoFHandler<dim>::cell_iterator &cell,
-                   const BlockVectorType &                        solution,
-                   LinearAlgebra::distributed::Vector<Number> &   particle_ids,
-                   const unsigned int                             id)
-      {
-        const double threshold_lower     = 0.8;  // TODO
-        const double invalid_particle_id = -1.0; // TODO
-
-        if (cell->has_children())
-          {
-            unsigned int counter = 0;
-
-            for (const auto &child : cell->child_iterators())
-              counter += run_flooding<dim>(child, solution, particle_ids, id);
-
-            return counter;
-          }
-
-        if (cell->is_locally_owned() == false)
-          return 0;
-
-        const auto particle_id = particle_ids[cell->global_active_cell_index()];
-
-        if (particle_id != invalid_particle_id)
-          return 0; // cell has been visited
-
-        Vector<double> values(cell->get_fe().n_dofs_per_cell());
-
-        if (false /* TODO */)
-          {
-            for (unsigned int b = 2; b < solution.n_blocks(); ++b)
-              {
-                cell->get_dof_values(solution.block(b), values);
-
-                if (values.linfty_norm() >= threshold_lower)
-                  return 0;
-              }
-          }
-        else
-          {
-            cell->get_dof_values(solution.block(0), values);
-
-            if (values.linfty_norm() >= threshold_lower)
-              return 0;
-          }
-
-        particle_ids[cell->global_active_cell_index()] = id;
-
-        unsigned int counter = 1;
-
-        for (const auto face : cell->face_indices())
-          if (cell->at_boundary(face) == false)
-            counter += run_flooding<dim>(cell->neighbor(face),
-                                         solution,
-                                         particle_ids,
-                                         id);
-
-        return counter;
-      }
-    } // namespace internal
-
     template <int dim, typename VectorType>
     void
     estimate_porosity(const Mapping<dim> &   mapping,
@@ -1029,9 +964,35 @@ namespace Sintering
       unsigned int counter = 0;
       unsigned int offset  = 0;
 
+      const double threshold_lower = 0.8; // TODO
+
+      Vector<double> values(dof_handler.get_fe().n_dofs_per_cell());
+
+      const auto is_pore = [&](const auto &cell) {
+        if (false /* TODO */)
+          {
+            for (unsigned int b = 2; b < solution.n_blocks(); ++b)
+              {
+                cell->get_dof_values(solution.block(b), values);
+
+                if (values.linfty_norm() >= threshold_lower)
+                  return false;
+              }
+          }
+        else
+          {
+            cell->get_dof_values(solution.block(0), values);
+
+            if (values.linfty_norm() >= threshold_lower)
+              return false;
+          }
+
+        return true;
+      };
+
       for (const auto &cell : dof_handler.active_cell_iterators())
-        if (internal::run_flooding<dim>(cell, solution, particle_ids, counter) >
-            0)
+        if (GrainTracker::run_flooding_if<dim>(
+              cell, is_pore, particle_ids, counter, invalid_particle_id) > 0)
           counter++;
 
       // step 2) determine the global number of locally determined particles
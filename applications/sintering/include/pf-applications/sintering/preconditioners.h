@@ -46,7 +46,9 @@ namespace Sintering
     unsigned int
     n_grains() const
     {
-      return data.n_grains();
+      // The order parameters only enter via symmetric functions, such that
+      // the kernel can be restricted to the grains active in the cell batch
+      return data.n_max_relevant_grains();
     }
 
     static constexpr unsigned int
@@ -62,13 +64,11 @@ namespace Sintering
       static_assert(n_grains != -1);
       const unsigned int cell = phi.get_current_cell_index();
 
-      const auto &free_energy      = data.free_energy;
-      const auto &mobility         = data.get_mobility();
-      const auto &kappa_c          = data.kappa_c;
-      const auto  weight           = this->data.time_data.get_primary_weight();
-      const auto &nonlinear_values = data.get_nonlinear_values();
-      const auto &nonlinear_gradients = data.get_nonlinear_gradients();
-      const auto  inv_dt = 1. / this->data.time_data.get_current_dt();
+      const auto &free_energy = data.free_energy;
+      const auto &mobility    = data.get_mobility();
+      const auto &kappa_c     = data.kappa_c;
+      const auto  weight      = this->data.time_data.get_primary_weight();
+      const auto  inv_dt      = 1. / this->data.time_data.get_current_dt();
 
       const bool use_coupled_model = data.has_additional_variables_attached();
 
@@ -80,26 +80,48 @@ namespace Sintering
       if (this->advection.enabled())
         this->advection.reinit(cell);
 
-      const auto grain_to_relevant_grain =
-        this->data.get_grain_to_relevant_grain(cell); // TODO: make optional
+      // Map local to global grain indices; unused local grains are padded
+      // with zeros, which do not contribute to the free energy and mobility
+      std::array<unsigned int, n_grains> relevant_grains;
+      unsigned int                       n_relevant_grains = n_grains;
+
+      if (data.cut_off_enabled())
+        {
+          const auto cell_relevant_grains = data.get_relevant_grains(cell);
+          n_relevant_grains               = cell_relevant_grains.size();
 
+          for (unsigned int ig = 0; ig < n_relevant_grains; ++ig)
+            relevant_grains[ig] = cell_relevant_grains[ig];
+        }
+      else
+        {
+          for (unsigned int ig = 0; ig < n_grains; ++ig)
+            relevant_grains[ig] = ig;
+        }
 
       for (unsigned int q = 0; q < phi.n_q_points; ++q)
         {
-          const auto &val  = nonlinear_values[cell][q];
-          const auto &grad = nonlinear_gradients[cell][q];
+          const auto *val  = data.get_nonlinear_values_uncompressed(cell, q);
+          const auto *grad = data.get_nonlinear_gradients_uncompressed(cell,
+                                                                       q);
 
           const auto &c       = val[0];
           const auto &c_grad  = grad[0];
           const auto &mu_grad = grad[1];
 
-          for (unsigned int ig = 0; ig < etas.size(); ++ig)
+          for (unsigned int ig = 0; ig < n_relevant_grains; ++ig)
             {
-              etas[ig] = val[2 + ig];
+              etas[ig] = val[2 + relevant_grains[ig]];
 
               if (SinteringOperatorData<dim, VectorizedArrayType>::
                     use_tensorial_mobility)
-                etas_grad[ig] = grad[2 + ig];
+                etas_grad[ig] = grad[2 + relevant_grains[ig]];
+            }
+
+          for (unsigned int ig = n_relevant_grains; ig < n_grains; ++ig)
+            {
+              etas[ig]      = VectorizedArrayType();
+              etas_grad[ig] = Tensor<1, dim, VectorizedArrayType>();
             }
 
           typename FECellIntegratorType::value_type    value_result;
@@ -132,20 +154,17 @@ namespace Sintering
             {
               Tensor<1, dim, VectorizedArrayType> lin_v_adv;
               for (unsigned int d = 0; d < dim; ++d)
-                lin_v_adv[d] = val[n_grains + 2 + d] * inv_dt;
+                lin_v_adv[d] = val[data.n_grains() + 2 + d] * inv_dt;
 
               value_result[0] += lin_v_adv * phi.get_gradient(q)[0];
             }
           else if (this->advection.enabled())
             {
-              for (unsigned int ig = 0; ig < n_grains; ++ig)
-                if (grain_to_relevant_grain[ig] !=
-                      static_cast<unsigned char>(255) &&
-                    this->advection.has_velocity(grain_to_relevant_grain[ig]))
+              for (unsigned int ig = 0; ig < n_relevant_grains; ++ig)
+                if (this->advection.has_velocity(ig))
                   {
                     const auto &velocity_ig =
-                      this->advection.get_velocity(grain_to_relevant_grain[ig],
-                                                   phi.quadrature_point(q));
+                      this->advection.get_velocity(ig, phi.quadrature_point(q));
 
                     value_result[0] += velocity_ig * phi.get_gradient(q)[0];
                   }
@@ -217,11 +236,9 @@ namespace Sintering
       static_assert(n_grains != -1);
       const unsigned int cell = phi.get_current_cell_index();
 
-      const auto &nonlinear_values = data.get_nonlinear_values();
-
       for (unsigned int q = 0; q < phi.n_q_points; ++q)
         {
-          const auto &val = nonlinear_values[cell][q];
+          const auto *val = data.get_nonlinear_values_uncompressed(cell, q);
 
           const auto &c = val[0];
 
@@ -323,8 +340,7 @@ namespace Sintering
           const auto &L           = data.get_mobility().Lgb();
           const auto &kappa_p     = data.kappa_p;
           const auto  weight      = this->data.time_data.get_primary_weight();
-          const auto &nonlinear_values = data.get_nonlinear_values();
-          const auto  inv_dt = 1. / this->data.time_data.get_current_dt();
+          const auto  inv_dt      = 1. / this->data.time_data.get_current_dt();
 
           const bool use_coupled_model =
             data.has_additional_variables_attached();
@@ -337,7 +353,7 @@ namespace Sintering
 
           for (unsigned int q = 0; q < phi.n_q_points; ++q)
             {
-              const auto &val = nonlinear_values[cell][q];
+              const auto *val = data.get_nonlinear_values_uncompressed(cell, q);
 
               const auto &c = val[0];
 
@@ -492,12 +508,11 @@ namespace Sintering
         {
           const unsigned int cell = phi.get_current_cell_index();
 
-          const auto &free_energy      = data.free_energy;
-          const auto &L                = data.get_mobility().Lgb();
-          const auto &kappa_p          = data.kappa_p;
-          const auto  weight           = data.time_data.get_primary_weight();
-          const auto &nonlinear_values = data.get_nonlinear_values();
-          const auto  inv_dt = 1. / this->data.time_data.get_current_dt();
+          const auto &free_energy = data.free_energy;
+          const auto &L           = data.get_mobility().Lgb();
+          const auto &kappa_p     = data.kappa_p;
+          const auto  weight      = data.time_data.get_primary_weight();
+          const auto  inv_dt      = 1. / this->data.time_data.get_current_dt();
 
           const bool use_coupled_model =
             data.has_additional_variables_attached();
@@ -510,7 +525,7 @@ namespace Sintering
 
           for (unsigned int q = 0; q < phi.n_q_points; ++q)
             {
-              const auto &val = nonlinear_values[cell][q];
+              const auto *val = data.get_nonlinear_values_uncompressed(cell, q);
 
               const auto &c = val[0];
 
@@ -662,12 +677,11 @@ namespace Sintering
                             integrator.get_active_quadrature_index())
             .lexicographic_numbering;
 
-        const auto &free_energy      = data.free_energy;
-        const auto &L                = data.get_mobility().Lgb();
-        const auto &kappa_p          = data.kappa_p;
-        const auto  weight           = data.time_data.get_primary_weight();
-        const auto &nonlinear_values = data.get_nonlinear_values();
-        const auto  inv_dt = 1. / this->data.time_data.get_current_dt();
+        const auto &free_energy = data.free_energy;
+        const auto &L           = data.get_mobility().Lgb();
+        const auto &kappa_p     = data.kappa_p;
+        const auto  weight      = data.time_data.get_primary_weight();
+        const auto  inv_dt      = 1. / this->data.time_data.get_current_dt();
 
         const bool use_coupled_model = data.has_additional_variables_attached();
 
@@ -711,8 +725,9 @@ namespace Sintering
 
             for (unsigned int q = 0; q < integrator.n_q_points; ++q)
               {
-                const auto &val = nonlinear_values[cell][q];
-                const auto &c   = val[0];
+                const auto *val =
+                  data.get_nonlinear_values_uncompressed(cell, q);
+                const auto &c = val[0];
 
                 for (unsigned int ig = 0; ig < this->n_grains(); ++ig)
                   etas[ig] = val[2 + ig];
@@ -758,8 +773,9 @@ namespace Sintering
                   {
                     for (unsigned int q = 0; q < integrator.n_q_points; ++q)
                       {
-                        const auto &val = nonlinear_values[cell][q];
-                        const auto &c   = val[0];
+                        const auto *val =
+                          data.get_nonlinear_values_uncompressed(cell, q);
+                        const auto &c = val[0];
 
                         for (unsigned int ig = 0; ig < this->n_grains(); ++ig)
                           etas[ig] = val[2 + ig];
@@ -779,7 +795,8 @@ namespace Sintering
 
                     for (unsigned int q = 0; q < integrator.n_q_points; ++q)
                       {
-                        const auto &val = nonlinear_values[cell][q];
+                        const auto *val =
+                          data.get_nonlinear_values_uncompressed(cell, q);
 
                         auto value    = integrator.get_value(q);
                         auto gradient = integrator.get_gradient(q);
@@ -964,6 +981,10 @@ namespace Sintering
     std::string block_1_approximation = "all";
 
     AMGData block_2_amg_data;
+
+    // keep the aggregates of the AMG hierarchies until the mesh or the
+    // number of components changes
+    bool reuse_amg_hierarchy = false;
   };
 
 
@@ -1028,8 +1049,20 @@ namespace Sintering
             plane_type);
 
       // create preconditioners
-      preconditioner_0 =
-        Preconditioners::create(*operator_0, data.block_0_preconditioner);
+      const auto create = [&](const auto &op, const std::string &label) {
+        if (label == "AMG" || label == "BlockAMG")
+          {
+            TrilinosWrappers::PreconditionAMG::AdditionalData additional_data;
+            return Preconditioners::create(op,
+                                           label,
+                                           additional_data,
+                                           data.reuse_amg_hierarchy);
+          }
+
+        return Preconditioners::create(op, label);
+      };
+
+      preconditioner_0 = create(*operator_0, data.block_0_preconditioner);
 
       AssertThrow((data.block_1_preconditioner != "GMG") &&
                     (data.block_1_preconditioner != "BlockGMG"),
@@ -1038,12 +1071,11 @@ namespace Sintering
       if (data.block_1_preconditioner == "AMG" ||
           data.block_1_preconditioner == "ILU" ||
           data.block_1_preconditioner == "InverseDiagonalMatrix")
-        preconditioner_1 =
-          Preconditioners::create(*operator_1, data.block_1_preconditioner);
+        preconditioner_1 = create(*operator_1, data.block_1_preconditioner);
       else if (data.block_1_preconditioner == "BlockAMG" ||
                data.block_1_preconditioner == "BlockILU")
-        preconditioner_1 = Preconditioners::create(*operator_1_blocked,
-                                                   data.block_1_preconditioner);
+        preconditioner_1 =
+          create(*operator_1_blocked, data.block_1_preconditioner);
       else
         {
           AssertThrow(false, ExcNotImplemented());
@@ -1064,13 +1096,13 @@ namespace Sintering
               preconditioner_2 =
                 Preconditioners::create(*operator_2,
                                         data.block_2_preconditioner,
-                                        additional_data);
+                                        additional_data,
+                                        data.reuse_amg_hierarchy);
             }
           else
             {
               preconditioner_2 =
-                Preconditioners::create(*operator_2,
-                                        data.block_2_preconditioner);
+                create(*operator_2, data.block_2_preconditioner);
             }
         }
     }
@@ -129,10 +129,11 @@ main(int argc, char **argv)
           params.geometry_data.minimize_order_parameters,
           is_accumulative);
 
-      AssertThrow(
-        initial_solution->n_order_parameters() <= MAX_SINTERING_GRAINS,
-        Sintering::ExcMaxGrainsExceeded(initial_solution->n_order_parameters(),
-                                        MAX_SINTERING_GRAINS));
+      AssertThrow(initial_solution->n_order_parameters() <=
+                    params.max_order_parameters(MAX_SINTERING_GRAINS),
+                  Sintering::ExcMaxGrainsExceeded(
+                    initial_solution->n_order_parameters(),
+                    params.max_order_parameters(MAX_SINTERING_GRAINS)));
 
       Sintering::Problem<SINTERING_DIM> runner(params, initial_solution);
     }
@@ -201,10 +202,11 @@ main(int argc, char **argv)
           n_order_params_to_use,
           is_accumulative);
 
-      AssertThrow(
-        initial_solution->n_order_parameters() <= MAX_SINTERING_GRAINS,
-        Sintering::ExcMaxGrainsExceeded(initial_solution->n_order_parameters(),
-                                        MAX_SINTERING_GRAINS));
+      AssertThrow(initial_solution->n_order_parameters() <=
+                    params.max_order_parameters(MAX_SINTERING_GRAINS),
+                  Sintering::ExcMaxGrainsExceeded(
+                    initial_solution->n_order_parameters(),
+                    params.max_order_parameters(MAX_SINTERING_GRAINS)));
 
       Sintering::Problem<SINTERING_DIM> runner(params, initial_solution);
     }
@@ -213,22 +215,32 @@ main(int argc, char **argv)
       AssertThrow(3 <= argc && argc <= 4,
                   ExcMessage("Argument cloud_file has to be provided!"));
 
-      std::string   file_cloud = std::string(argv[2]);
-      std::ifstream fstream(file_cloud);
-      AssertThrow(fstream.is_open(), ExcMessage("File not found!"));
+      std::string file_cloud = std::string(argv[2]);
 
-      const auto particles = Sintering::read_particles<SINTERING_DIM>(fstream);
+      const auto cloud =
+        Sintering::read_particle_cloud<SINTERING_DIM>(file_cloud);
 
       // Output case specific info
       pcout << "Mode:       cloud" << std::endl;
       pcout << "Cloud path: " << file_cloud << std::endl;
       pcout << std::endl;
 
-      pcout << "Particles list:" << std::endl;
-      fstream.clear();
-      fstream.seekg(0);
-      pcout << fstream.rdbuf();
-      pcout << std::endl;
+      if (Sintering::is_binary_cloud(file_cloud))
+        {
+          pcout << "Binary cloud: " << cloud.particles.size()
+                << " particles, " << cloud.contacts.size() << " contacts, "
+                << (cloud.colors.empty() ? "no coloring" : "with coloring")
+                << std::endl;
+          pcout << std::endl;
+        }
+      else
+        {
+          std::ifstream fstream(file_cloud);
+
+          pcout << "Particles list:" << std::endl;
+          pcout << fstream.rdbuf();
+          pcout << std::endl;
+        }
 
       if (argc == 4)
         {
@@ -246,15 +258,16 @@ main(int argc, char **argv)
 
       const auto initial_solution =
         std::make_shared<Sintering::InitialValuesCloud<SINTERING_DIM>>(
-          particles,
+          cloud,
           params.geometry_data.interface_width,
           params.geometry_data.minimize_order_parameters,
           params.geometry_data.interface_buffer_ratio);
 
-      AssertThrow(
-        initial_solution->n_order_parameters() <= MAX_SINTERING_GRAINS,
-        Sintering::ExcMaxGrainsExceeded(initial_solution->n_order_parameters(),
-                                        MAX_SINTERING_GRAINS));
+      AssertThrow(initial_solution->n_order_parameters() <=
+                    params.max_order_parameters(MAX_SINTERING_GRAINS),
+                  Sintering::ExcMaxGrainsExceeded(
+                    initial_solution->n_order_parameters(),
+                    params.max_order_parameters(MAX_SINTERING_GRAINS)));
 
       Sintering::Problem<SINTERING_DIM> runner(params, initial_solution);
     }
@@ -23,6 +23,61 @@ main(int argc, char **argv)
 
   const unsigned int dim = 3;
 
+  /* Convert text clouds into the binary format together with the contacts
+   * and the coloring for the given interface parameters:
+   *   sintering-print-particles --convert interface_width
+   *     interface_buffer_ratio file_0 [file_1 ...]
+   */
+  if (argc > 1 && std::string(argv[1]) == "--convert")
+    {
+      AssertThrow(argc > 4,
+                  ExcMessage("Usage: --convert interface_width "
+                             "interface_buffer_ratio file_0 [file_1 ...]"));
+
+      const double interface_width        = std::stod(argv[2]);
+      const double interface_buffer_ratio = std::stod(argv[3]);
+
+      for (int i = 4; i < argc; ++i)
+        {
+          const auto file_name = std::filesystem::path(argv[i]);
+
+          auto cloud = Sintering::read_particle_cloud<dim>(file_name);
+
+          const bool minimize_order_parameters = true;
+
+          const Sintering::InitialValuesCloud<dim> initial_solution(
+            cloud,
+            interface_width,
+            minimize_order_parameters,
+            interface_buffer_ratio);
+
+          cloud.has_contacts = true;
+          cloud.contacts     = initial_solution.get_contacts();
+
+          cloud.colors = initial_solution.get_particle_to_order_parameter();
+
+          cloud.interface_width        = interface_width;
+          cloud.interface_buffer_ratio = interface_buffer_ratio;
+
+          const auto output_name =
+            file_name.parent_path() /
+            (std::string(file_name.stem()) + ".bcloud");
+
+          if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+            {
+              Sintering::write_binary_cloud(output_name, cloud);
+
+              std::cout << file_name << " -> " << output_name << ": "
+                        << cloud.particles.size() << " particles, "
+                        << cloud.contacts.size() << " contacts, "
+                        << initial_solution.n_order_parameters()
+                        << " order parameters" << std::endl;
+            }
+        }
+
+      return 0;
+    }
+
   for (int i = 1; i < argc; ++i)
     {
       const auto file_name = std::string(argv[i]);
@@ -30,9 +85,8 @@ main(int argc, char **argv)
         std::string(std::filesystem::path(file_name).stem());
       const auto parent_path = std::filesystem::path(file_name).parent_path();
 
-      std::ifstream fstream(file_name);
-
-      const auto particles = Sintering::read_particles<dim>(fstream);
+      const auto cloud     = Sintering::read_particle_cloud<dim>(file_name);
+      const auto particles = cloud.particles;
 
       const double interface_width           = 0.0;
       const bool   minimize_order_parameters = true;
@@ -40,7 +94,7 @@ main(int argc, char **argv)
 
       const auto initial_solution =
         std::make_shared<Sintering::InitialValuesCloud<dim>>(
-          particles,
+          cloud,
           interface_width,
           minimize_order_parameters,
           interface_buffer_ratio);
@@ -100,6 +100,12 @@ main(int argc, char **argv)
   using BlockVectorType =
     LinearAlgebra::distributed::DynamicBlockVector<Number>;
 
+  // single-precision Jacobian as used in the mixed-precision mode
+  using NumberFloat              = float;
+  using VectorizedArrayTypeFloat = VectorizedArray<NumberFloat>;
+  using BlockVectorTypeFloat =
+    LinearAlgebra::distributed::DynamicBlockVector<NumberFloat>;
+
   const bool scalar_mobility =
     SinteringOperatorData<dim, VectorizedArrayType>::use_tensorial_mobility ==
     false;
@@ -181,6 +187,21 @@ main(int argc, char **argv)
   matrix_free.reinit(
     mapping, dof_handler, constraints, *quadrature, additional_data);
 
+  AffineConstraints<NumberFloat> constraints_float;
+
+  typename MatrixFree<dim, NumberFloat, VectorizedArrayTypeFloat>::
+    AdditionalData additional_data_float;
+  additional_data_float.mapping_update_flags =
+    additional_data.mapping_update_flags;
+  additional_data_float.overlap_communication_computation = false;
+
+  MatrixFree<dim, NumberFloat, VectorizedArrayTypeFloat> matrix_free_float;
+  matrix_free_float.reinit(mapping,
+                           dof_handler,
+                           constraints_float,
+                           *quadrature,
+                           additional_data_float);
+
   ConvergenceTable table;
 
   const auto test_operator = [&](const auto &op, const std::string label) {
@@ -309,10 +330,60 @@ main(int argc, char **argv)
 
 
             test_operator(sintering_operator, "sintering");
+
+            // ... and the same Jacobian in single precision
+            TimeIntegration::SolutionHistory<BlockVectorTypeFloat>
+              solution_history_float(time_integration_order + 1);
+
+            SinteringOperatorData<dim, VectorizedArrayTypeFloat>
+              sintering_data_float(A,
+                                   B,
+                                   kappa_c,
+                                   kappa_p,
+                                   mobility_provider,
+                                   time_integration_order);
+
+            sintering_data_float.set_n_components(n_components);
+            sintering_data_float.time_data.set_all_dt(
+              std::vector<NumberFloat>(dts.begin(), dts.end()));
+            sintering_data_float.set_time(t);
+
+            AdvectionMechanism<dim, NumberFloat, VectorizedArrayTypeFloat>
+              advection_mechanism_float;
+
+            const SinteringOperatorGeneric<dim,
+                                           NumberFloat,
+                                           VectorizedArrayTypeFloat>
+              sintering_operator_float(matrix_free_float,
+                                       constraints_float,
+                                       sintering_data_float,
+                                       solution_history_float,
+                                       advection_mechanism_float,
+                                       false,
+                                       true);
+
+            BlockVectorTypeFloat src_float, dst_float;
+            sintering_operator_float.initialize_dof_vector(src_float);
+            sintering_operator_float.initialize_dof_vector(dst_float);
+            src_float = 1.0;
+
+            sintering_data_float.fill_quadrature_point_values(matrix_free_float,
+                                                              src_float,
+                                                              false,
+                                                              false);
+
+            const auto time = run_measurement(
+              [&]() { sintering_operator_float.vmult(dst_float, src_float); });
+
+            table.add_value("t_sintering_mf_float", time);
+            table.set_scientific("t_sintering_mf_float", true);
           }
         else
           {
             test_operator_dummy("sintering");
+
+            table.add_value("t_sintering_mf_float", 0);
+            table.set_scientific("t_sintering_mf_float", true);
           }
 
       if constexpr (test_sintering_wang)
@@ -12,226 +12,361 @@ namespace GrainTracker
 {
   using namespace dealii;
 
-  template <int dim, typename VectorSolution, typename VectorIds>
+  /**
+   * Flood fill starting from @p cell: all connected locally owned cells for
+   * which @p is_particle returns true and that have not been visited yet get
+   * the id @p id. Returns the number of cells labeled.
+   *
+   * The cells are processed with an explicit work stack instead of recursion
+   * so that the labeling of large, highly refined particles does not depend
+   * on the stack size. Neighbors are visited depth first, which keeps the
+   * accessed cells close to each other; callers are expected to loop over
+   * the seed cells in the (space-filling curve) order of the active cell
+   * iterators.
+   */
+  template <int dim, typename Predicate, typename VectorIds>
   unsigned int
-  run_flooding(const typename DoFHandler<dim>::cell_iterator &cell,
-               const VectorSolution &                         solution,
-               VectorIds &                                    particle_ids,
-               const unsigned int                             id,
-               const double threshold_lower     = 0,
-               const double invalid_particle_id = -1.0)
+  run_flooding_if(const typename DoFHandler<dim>::cell_iterator &cell,
+                  const Predicate &                              is_particle,
+                  VectorIds &                                    particle_ids,
+                  const unsigned int                             id,
+                  const double invalid_particle_id = -1.0)
   {
-    if (cell->has_children())
-      {
-        unsigned int counter = 0;
+    const auto is_visited = [&](const auto &cell) {
+      return (cell->is_locally_owned() == false) ||
+             (particle_ids[cell->global_active_cell_index()] !=
+              invalid_particle_id);
+    };
+
+    // quick return for seeds that are done already, this avoids setting up
+    // the work stack in the common case
+    if (cell->is_active() && is_visited(cell))
+      return 0;
 
-        for (const auto &child : cell->child_iterators())
-          counter += run_flooding<dim>(child,
-                                       solution,
-                                       particle_ids,
-                                       id,
-                                       threshold_lower,
-                                       invalid_particle_id);
+    std::vector<typename DoFHandler<dim>::cell_iterator> work_stack;
+    work_stack.push_back(cell);
 
-        return counter;
-      }
+    unsigned int counter = 0;
 
-    if (cell->is_locally_owned() == false)
-      return 0;
+    while (work_stack.empty() == false)
+      {
+        const auto current = work_stack.back();
+        work_stack.pop_back();
 
-    const auto particle_id = particle_ids[cell->global_active_cell_index()];
+        if (current->has_children())
+          {
+            for (const auto &child : current->child_iterators())
+              work_stack.push_back(child);
 
-    if (particle_id != invalid_particle_id)
-      return 0; // cell has been visited
+            continue;
+          }
 
-    Vector<double> values(cell->get_fe().n_dofs_per_cell());
+        if (is_visited(current))
+          continue; // cell has been visited or is not owned
 
-    cell->get_dof_values(solution, values);
+        if (is_particle(current) == false)
+          continue; // cell has no particle
 
-    if (values.linfty_norm() < threshold_lower)
-      return 0; // cell has no particle
+        particle_ids[current->global_active_cell_index()] = id;
+        ++counter;
 
-    particle_ids[cell->global_active_cell_index()] = id;
+        for (const auto face : current->face_indices())
+          if (current->at_boundary(face) == false)
+            work_stack.push_back(current->neighbor(face));
+      }
 
-    unsigned int counter = 1;
+    return counter;
+  }
+
+  template <int dim, typename VectorSolution, typename VectorIds>
+  unsigned int
+  run_flooding(const typename DoFHandler<dim>::cell_iterator &cell,
+               const VectorSolution &                         solution,
+               VectorIds &                                    particle_ids,
+               const unsigned int                             id,
+               const double threshold_lower     = 0,
+               const double invalid_particle_id = -1.0)
+  {
+    Vector<double> values(cell->get_dof_handler().get_fe().n_dofs_per_cell());
 
-    for (const auto face : cell->face_indices())
-      if (cell->at_boundary(face) == false)
-        counter += run_flooding<dim>(cell->neighbor(face),
-                                     solution,
-                                     particle_ids,
-                                     id,
-                                     threshold_lower,
-                                     invalid_particle_id);
+    const auto is_particle = [&](const auto &cell) {
+      cell->get_dof_values(solution, values);
+      return values.linfty_norm() >= threshold_lower;
+    };
 
-    return counter;
+    return run_flooding_if<dim>(
+      cell, is_particle, particle_ids, id, invalid_particle_id);
   }
 
+  /**
+   * Determine the cliques of particles distributed among processes. The entry
+   * @p input[i] lists (rank, global id) of the particles on other processes
+   * touching the i-th local particle. The returned vector contains the clique
+   * id of each local particle; the cliques are numbered in the order of their
+   * smallest particle.
+   *
+   * The cliques are found by a distributed union-find: each particle keeps a
+   * pointer to the smallest particle it is known to be connected to. In each
+   * round, the pointers are sent to the neighbors, the replaced pointers are
+   * hooked onto the new ones and the pointers are shortened by pointer
+   * jumping. Only pointers are communicated, and the number of rounds grows
+   * with the logarithm of the extent of a clique. The number of rounds,
+   * including the last one that detects that nothing has changed, is
+   * returned in @p n_rounds if provided.
+   */
   std::vector<unsigned int>
   perform_distributed_stitching(
     const MPI_Comm                                                   comm,
     std::vector<std::vector<std::tuple<unsigned int, unsigned int>>> input,
-    MyTimerOutput *timer = nullptr)
+    MyTimerOutput *timer    = nullptr,
+    unsigned int * n_rounds = nullptr)
   {
     ScopedName sc("perform_distributed_stitching");
     MyScope    scope(sc, timer);
 
-    const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
     const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
 
-    // step 1) determine - via fixed-point iteration - the clique of
-    // each particle
     const unsigned int local_size = input.size();
     unsigned int       offset     = 0;
 
     MPI_Exscan(&local_size, &offset, 1, MPI_UNSIGNED, MPI_SUM, comm);
 
-    using T = std::vector<
-      std::tuple<unsigned int,
-                 std::vector<std::tuple<unsigned int, unsigned int>>>>;
+    // (rank, global id) of a particle; since the global ids are assigned
+    // rank by rank, the lexicographical order is the order of the global ids
+    using Pointer = std::tuple<unsigned int, unsigned int>;
 
-    unsigned int iter = 0;
+    // (global id of the target particle, rank, global id)
+    using T = std::vector<std::tuple<unsigned int, unsigned int, unsigned int>>;
 
-    while (true)
-      {
-        ScopedName sc("fp_iter_" + std::to_string(iter));
-        MyScope    scope(sc, timer);
+    const auto exchange = [&](std::map<unsigned int, T> &data_to_send,
+                              const auto &               process) {
+      // data for local particles does not need to be communicated
+      const auto local_data = data_to_send.find(my_rank);
+      if (local_data != data_to_send.end())
+        {
+          process(local_data->second);
+          data_to_send.erase(local_data);
+        }
 
-        std::map<unsigned int, T> data_to_send;
+      Utilities::MPI::ConsensusAlgorithms::selector<T>(
+        [&]() {
+          std::vector<unsigned int> targets;
+          for (const auto &i : data_to_send)
+            targets.emplace_back(i.first);
+          return targets;
+        }(),
+        [&](const unsigned int other_rank) {
+          return data_to_send[other_rank];
+        },
+        [&](const unsigned int, const T &data) { process(data); },
+        comm);
+    };
 
-        for (unsigned int i = 0; i < input.size(); ++i)
-          {
-            const auto input_i = input[i];
-            for (unsigned int j = 0; j < input_i.size(); ++j)
-              {
-                const unsigned int other_rank = std::get<0>(input_i[j]);
+    // step 0) make the connectivity symmetric
+    {
+      std::map<unsigned int, T> data_to_send;
+
+      for (unsigned int i = 0; i < input.size(); ++i)
+        for (const auto &[other_rank, other_id] : input[i])
+          data_to_send[other_rank].emplace_back(other_id, my_rank, i + offset);
+
+      exchange(data_to_send, [&](const T &data) {
+        for (const auto &[id, other_rank, other_id] : data)
+          input[id - offset].emplace_back(other_rank, other_id);
+      });
+
+      for (auto &input_i : input)
+        {
+          std::sort(input_i.begin(), input_i.end());
+          input_i.erase(std::unique(input_i.begin(), input_i.end()),
+                        input_i.end());
+        }
+    }
 
-                if (other_rank == my_rank)
-                  continue;
+    // step 1) determine - via union-find with pointer jumping - the smallest
+    // particle (root) of the clique of each particle
+    std::vector<Pointer> parents(local_size);
+    for (unsigned int i = 0; i < local_size; ++i)
+      parents[i] = Pointer{my_rank, i + offset};
 
-                std::vector<std::tuple<unsigned int, unsigned int>> temp;
+    unsigned int n_iterations = 0;
 
-                temp.emplace_back(my_rank, i + offset);
+    for (bool changed = true; changed; ++n_iterations)
+      {
+        ScopedName sc("union_find");
+        MyScope    scope(sc, timer);
 
-                for (unsigned int k = 0; k < input_i.size(); ++k)
-                  if (k != j)
-                    temp.push_back(input_i[k]);
+        changed = false;
 
-                std::sort(temp.begin(), temp.end());
+        std::map<unsigned int, T> hooks;
 
-                data_to_send[other_rank].emplace_back(std::get<1>(input_i[j]),
-                                                      temp);
-              }
-          }
+        const auto lower =
+          [&](const unsigned int i, const Pointer &parent, const bool hook) {
+            if ((parent < parents[i]) == false)
+              return;
 
-        bool finished = true;
+            const auto &[old_rank, old_id] = parents[i];
 
-        Utilities::MPI::ConsensusAlgorithms::selector<T>(
-          [&]() {
-            std::vector<unsigned int> targets;
-            for (const auto &i : data_to_send)
-              targets.emplace_back(i.first);
-            return targets;
-          }(),
-          [&](const unsigned int other_rank) {
-            return data_to_send[other_rank];
-          },
-          [&](const unsigned int, const auto &data) {
-            for (const auto &data_i : data)
-              {
-                const unsigned int index   = std::get<0>(data_i) - offset;
-                const auto &       values  = std::get<1>(data_i);
-                auto &             input_i = input[index];
+            // the old parent is part of the same clique
+            if (hook && (old_id != i + offset))
+              hooks[old_rank].emplace_back(old_id,
+                                           std::get<0>(parent),
+                                           std::get<1>(parent));
 
-                const unsigned int old_size = input_i.size();
+            parents[i] = parent;
+            changed    = true;
+          };
 
-                input_i.insert(input_i.end(), values.begin(), values.end());
-                std::sort(input_i.begin(), input_i.end());
-                input_i.erase(std::unique(input_i.begin(), input_i.end()),
-                              input_i.end());
+        // a) send the parents to the neighbors
+        {
+          std::map<unsigned int, T> data_to_send;
 
-                const unsigned int new_size = input_i.size();
+          for (unsigned int i = 0; i < input.size(); ++i)
+            for (const auto &[other_rank, other_id] : input[i])
+              data_to_send[other_rank].emplace_back(other_id,
+                                                    std::get<0>(parents[i]),
+                                                    std::get<1>(parents[i]));
 
-                finished &= (old_size == new_size);
-              }
-          },
-          comm);
+          exchange(data_to_send, [&](const T &data) {
+            for (const auto &[id, parent_rank, parent_id] : data)
+              lower(id - offset, Pointer{parent_rank, parent_id}, true);
+          });
+        }
 
-        if (Utilities::MPI::sum(static_cast<unsigned int>(finished), comm) ==
-            n_ranks) // run as long as no clique has changed
-          break;
+        // b) hook the replaced parents onto the new ones
+        exchange(hooks, [&](const T &data) {
+          for (const auto &[id, parent_rank, parent_id] : data)
+            lower(id - offset, Pointer{parent_rank, parent_id}, false);
+        });
 
-        ++iter;
-      }
+        // c) pointer jumping: replace the parent by its parent; the parents
+        // of the beginning of this step are used so that the result and the
+        // number of rounds do not depend on the order of the messages
+        {
+          const std::vector<Pointer> parents_old = parents;
 
-    // step 2) give each clique a unique id
-    std::vector<std::vector<std::tuple<unsigned int, unsigned int>>>
-      input_valid;
+          std::map<unsigned int, std::vector<unsigned int>> requests;
+          std::map<unsigned int, std::vector<unsigned int>> requesters;
 
-    for (unsigned int i = 0; i < input.size(); ++i)
-      {
-        auto input_i = input[i];
+          for (unsigned int i = 0; i < local_size; ++i)
+            {
+              const auto [parent_rank, parent_id] = parents[i];
+
+              if (parent_id == i + offset)
+                continue;
+
+              if (parent_rank == my_rank)
+                {
+                  const Pointer grand_parent = parents_old[parent_id - offset];
+                  lower(i, grand_parent, false);
+                }
+              else
+                {
+                  requests[parent_rank].push_back(parent_id);
+                  requesters[parent_rank].push_back(i);
+                }
+            }
 
-        if (input_i.size() == 0)
-          {
-            std::vector<std::tuple<unsigned int, unsigned int>> temp;
-            temp.emplace_back(my_rank, i + offset);
-            input_valid.push_back(temp);
-          }
-        else
-          {
-            if ((my_rank <= std::get<0>(input_i[0])) &&
-                ((i + offset) < std::get<1>(input_i[0])))
-              {
-                input_i.insert(
-                  input_i.begin(),
-                  std::tuple<unsigned int, unsigned int>{my_rank, i + offset});
-                input_valid.push_back(input_i);
-              }
-          }
+          Utilities::MPI::ConsensusAlgorithms::
+            selector<std::vector<unsigned int>, std::vector<Pointer>>(
+              [&]() {
+                std::vector<unsigned int> targets;
+                for (const auto &i : requests)
+                  targets.emplace_back(i.first);
+                return targets;
+              }(),
+              [&](const unsigned int other_rank) {
+                return requests[other_rank];
+              },
+              [&](const unsigned int, const std::vector<unsigned int> &ids) {
+                std::vector<Pointer> answer;
+                for (const auto id : ids)
+                  answer.push_back(parents_old[id - offset]);
+                return answer;
+              },
+              [&](const unsigned int          other_rank,
+                  const std::vector<Pointer> &answer) {
+                const auto &indices = requesters[other_rank];
+                for (unsigned int k = 0; k < indices.size(); ++k)
+                  lower(indices[k], answer[k], false);
+              },
+              comm);
+        }
+
+        // run as long as any pointer has changed
+        changed =
+          Utilities::MPI::max(static_cast<unsigned int>(changed), comm) != 0;
       }
 
-    // step 3) notify each particle of the id of its clique
-    const unsigned int local_size_p = input_valid.size();
-    unsigned int       offset_p     = 0;
+    if (n_rounds)
+      *n_rounds = n_iterations;
 
-    MPI_Exscan(&local_size_p, &offset_p, 1, MPI_UNSIGNED, MPI_SUM, comm);
+    // step 2) give each clique a unique id, the roots are numbered in the
+    // order of their global ids
+    std::vector<unsigned int> result(local_size,
+                                     numbers::invalid_unsigned_int);
 
-    using U = std::vector<std::tuple<unsigned int, unsigned int>>;
-    std::map<unsigned int, U> data_to_send_;
+    unsigned int n_local_roots = 0;
+    for (unsigned int i = 0; i < local_size; ++i)
+      if (std::get<1>(parents[i]) == i + offset)
+        ++n_local_roots;
 
-    for (unsigned int i = 0; i < input_valid.size(); ++i)
-      {
-        for (const auto &j : input_valid[i])
-          data_to_send_[std::get<0>(j)].emplace_back(std::get<1>(j),
-                                                     i + offset_p);
-      }
+    unsigned int root_offset = 0;
+    MPI_Exscan(&n_local_roots, &root_offset, 1, MPI_UNSIGNED, MPI_SUM, comm);
 
-    std::vector<unsigned int> result(input.size(),
-                                     numbers::invalid_unsigned_int);
+    for (unsigned int i = 0; i < local_size; ++i)
+      if (std::get<1>(parents[i]) == i + offset)
+        result[i] = root_offset++;
 
+    // step 3) notify each particle of the id of its clique; after the
+    // union-find each particle points to its root directly
     {
       ScopedName sc("notify");
       MyScope    scope(sc, timer);
-      Utilities::MPI::ConsensusAlgorithms::selector<U>(
-        [&]() {
-          std::vector<unsigned int> targets;
-          for (const auto &i : data_to_send_)
-            targets.emplace_back(i.first);
-          return targets;
-        }(),
-        [&](const unsigned int other_rank) {
-          return data_to_send_[other_rank];
-        },
-        [&](const unsigned int, const auto &data) {
-          for (const auto &i : data)
+
+      std::map<unsigned int, std::vector<unsigned int>> requests;
+      std::map<unsigned int, std::vector<unsigned int>> requesters;
+
+      for (unsigned int i = 0; i < local_size; ++i)
+        {
+          const auto [root_rank, root_id] = parents[i];
+
+          if (root_id == i + offset)
+            continue;
+
+          if (root_rank == my_rank)
             {
-              AssertDimension(result[std::get<0>(i) - offset],
-                              numbers::invalid_unsigned_int);
-              result[std::get<0>(i) - offset] = std::get<1>(i);
+              result[i] = result[root_id - offset];
             }
-        },
-        comm);
+          else
+            {
+              requests[root_rank].push_back(root_id);
+              requesters[root_rank].push_back(i);
+            }
+        }
+
+      Utilities::MPI::ConsensusAlgorithms::
+        selector<std::vector<unsigned int>, std::vector<unsigned int>>(
+          [&]() {
+            std::vector<unsigned int> targets;
+            for (const auto &i : requests)
+              targets.emplace_back(i.first);
+            return targets;
+          }(),
+          [&](const unsigned int other_rank) { return requests[other_rank]; },
+          [&](const unsigned int, const std::vector<unsigned int> &ids) {
+            std::vector<unsigned int> answer;
+            for (const auto id : ids)
+              answer.push_back(result[id - offset]);
+            return answer;
+          },
+          [&](const unsigned int               other_rank,
+              const std::vector<unsigned int> &answer) {
+            const auto &indices = requesters[other_rank];
+            for (unsigned int k = 0; k < indices.size(); ++k)
+              result[indices[k]] = answer[k];
+          },
+          comm);
     }
 
     MPI_Barrier(comm);
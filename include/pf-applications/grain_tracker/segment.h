@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/point.h>
 
 namespace GrainTracker
@@ -41,6 +42,24 @@ namespace GrainTracker
       return current_distance;
     }
 
+    /* Axis-aligned box around the segment enlarged by the given extension,
+     * used to index the segments in an R-tree.
+     */
+    BoundingBox<dim>
+    bounding_box(const double extension = 0.0) const
+    {
+      Point<dim> lower = center;
+      Point<dim> upper = center;
+
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          lower[d] -= radius + extension;
+          upper[d] += radius + extension;
+        }
+
+      return BoundingBox<dim>(std::make_pair(lower, upper));
+    }
+
   protected:
     Point<dim> center;
 
@@ -13,6 +13,7 @@
 #include <deal.II/matrix_free/matrix_free.h>
 
 #include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/rtree.h>
 
 #include <deal.II/particles/data_out.h>
 #include <deal.II/particles/particle_handler.h>
@@ -57,7 +58,8 @@ namespace GrainTracker
             const double       buffer_distance_ratio                = 0.05,
             const double       buffer_distance_fixed                = 0.0,
             const unsigned int order_parameters_offset              = 2,
-            const bool         do_timing                            = true)
+            const bool         do_timing                            = true,
+            const bool         incremental                          = false)
       : dof_handler(dof_handler)
       , tria(tria)
       , greedy_init(greedy_init)
@@ -69,6 +71,7 @@ namespace GrainTracker
       , buffer_distance_ratio(buffer_distance_ratio)
       , buffer_distance_fixed(buffer_distance_fixed)
       , order_parameters_offset(order_parameters_offset)
+      , incremental(incremental)
       , pcout(std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
       , timer(do_timing)
     {}
@@ -90,9 +93,13 @@ namespace GrainTracker
                                                buffer_distance_ratio,
                                                buffer_distance_fixed,
                                                order_parameters_offset,
-                                               timer.is_enabled());
+                                               timer.is_enabled(),
+                                               incremental);
 
       new_tracker->op_particle_ids           = this->op_particle_ids;
+      new_tracker->op_particle_centers       = this->op_particle_centers;
+      new_tracker->op_particle_radii         = this->op_particle_radii;
+      new_tracker->labels_up_to_date         = this->labels_up_to_date;
       new_tracker->particle_ids_to_grain_ids = this->particle_ids_to_grain_ids;
       new_tracker->grain_segment_ids_numbering =
         this->grain_segment_ids_numbering;
@@ -123,8 +130,20 @@ namespace GrainTracker
       // Now we do not assign grain indices when searching for grains
       const bool assign_indices = false;
 
-      const auto new_grains =
-        detect_grains(solution, n_order_params, assign_indices);
+      // Relabel only the changed cells if the particle ids of the previous
+      // step are still valid, i.e., neither the mesh nor the order
+      // parameters have been changed since then
+      const bool use_incremental =
+        incremental && labels_up_to_date && (n_order_params > 0) &&
+        (op_particle_ids.n_blocks() == n_order_params) &&
+        (particle_ids_to_grain_ids.size() == n_order_params) &&
+        (op_particle_ids.block(0).get_partitioner() ==
+         tria.global_active_cell_index_partitioner().lock());
+
+      const auto new_grains = detect_grains(solution,
+                                            n_order_params,
+                                            assign_indices,
+                                            use_incremental);
 
       // Numberer for new grains
       unsigned int grain_numberer = old_grains.rbegin()->first + 1;
@@ -136,6 +155,19 @@ namespace GrainTracker
           grains_candidates.insert(gid);
         }
 
+      // Index the segments of the old grains, only segments whose boxes
+      // intersect the box of a new segment can be matched with it
+      std::vector<BoundingBox<dim>>                      old_segments_boxes;
+      std::vector<std::pair<unsigned int, unsigned int>> old_segments_ids;
+      for (const auto &[gid, gr] : old_grains)
+        for (unsigned int s = 0; s < gr.n_segments(); ++s)
+          {
+            old_segments_boxes.push_back(gr.get_segments()[s].bounding_box());
+            old_segments_ids.emplace_back(gid, s);
+          }
+
+      const auto old_segments_tree = pack_rtree_of_indices(old_segments_boxes);
+
       // Create segments and transfer grain_id's for them
       for (const auto &[current_grain_id, new_grain] : new_grains)
         {
@@ -147,29 +179,50 @@ namespace GrainTracker
           double       min_distance = std::numeric_limits<double>::max();
           unsigned int new_grain_id = std::numeric_limits<unsigned int>::max();
 
-          for (const auto &new_segment : new_grain.get_segments())
+          // Ties are resolved in the order (new segment, old grain, old
+          // segment) independently of the order of the R-tree query
+          std::tuple<unsigned int, unsigned int, unsigned int> min_position;
+
+          for (unsigned int s = 0; s < new_grain.n_segments(); ++s)
             {
-              for (const auto &old_grain_id : grains_candidates)
+              const auto &new_segment = new_grain.get_segments()[s];
+
+              for (const auto i :
+                   old_segments_tree |
+                     boost::geometry::index::adaptors::queried(
+                       boost::geometry::index::intersects(
+                         new_segment.bounding_box())))
                 {
+                  const auto [old_grain_id, old_segment_id] =
+                    old_segments_ids[i];
+
+                  if (grains_candidates.find(old_grain_id) ==
+                      grains_candidates.end())
+                    continue;
+
                   const auto &old_grain = old_grains.at(old_grain_id);
 
-                  if (new_grain.get_order_parameter_id() ==
+                  if (new_grain.get_order_parameter_id() !=
                       old_grain.get_order_parameter_id())
-                    {
-                      for (const auto &old_segment : old_grain.get_segments())
-                        {
-                          const double distance =
-                            new_segment.get_center().distance(
-                              old_segment.get_center());
+                    continue;
 
-                          if (distance < std::max(new_segment.get_radius(),
-                                                  old_segment.get_radius()) &&
-                              distance < min_distance)
-                            {
-                              min_distance = distance;
-                              new_grain_id = old_grain.get_grain_id();
-                            }
-                        }
+                  const auto &old_segment =
+                    old_grain.get_segments()[old_segment_id];
+
+                  const double distance = new_segment.get_center().distance(
+                    old_segment.get_center());
+
+                  const auto position =
+                    std::make_tuple(s, old_grain_id, old_segment_id);
+
+                  if (distance < std::max(new_segment.get_radius(),
+                                          old_segment.get_radius()) &&
+                      (distance < min_distance ||
+                       (distance == min_distance && position < min_position)))
+                    {
+                      min_distance = distance;
+                      min_position = position;
+                      new_grain_id = old_grain.get_grain_id();
                     }
                 }
             }
@@ -377,6 +430,9 @@ namespace GrainTracker
       if (n_grains_remapped == 0)
         return n_grains_remapped;
 
+      // The stored particle ids do not match the order parameters anymore
+      labels_up_to_date = false;
+
       // Init remapping cache
       std::map<std::vector<unsigned int>, std::list<Remapping>>
         remappings_cache;
@@ -668,6 +724,8 @@ namespace GrainTracker
     {
       callback(grains);
 
+      labels_up_to_date = false;
+
       // Rebuild completely active order parameters
       active_order_parameters = build_active_order_parameter_ids(grains);
     }
@@ -676,7 +734,8 @@ namespace GrainTracker
     std::map<unsigned int, Grain<dim>>
     detect_grains(const BlockVectorType &solution,
                   const unsigned int     n_order_params,
-                  const bool             assign_indices)
+                  const bool             assign_indices,
+                  const bool             incremental = false)
     {
       ScopedName sc("detect_grains");
       MyScope    scope(timer, sc, timer.is_enabled());
@@ -688,68 +747,223 @@ namespace GrainTracker
       // Numerator
       unsigned int grains_numerator = 0;
 
-      // Order parameter indices stored per cell
-      op_particle_ids.reinit(n_order_params);
-      for (unsigned int b = 0; b < op_particle_ids.n_blocks(); ++b)
-        op_particle_ids.block(b).reinit(
-          tria.global_active_cell_index_partitioner().lock());
+      /* In the incremental mode, the particle ids of the previous call are
+       * kept and only the particles touched by cells whose order parameter
+       * crossed the threshold are relabeled. These get ids starting from
+       * the number of previous particles (n_old_particles), the other ones
+       * keep their ids and geometry.
+       */
+      std::vector<unsigned int> n_old_particles(n_order_params, 0);
+      std::vector<std::vector<unsigned int>> affected_particles(
+        n_order_params);
+
+      if (incremental)
+        {
+          for (unsigned int op = 0; op < n_order_params; ++op)
+            {
+              n_old_particles[op] = particle_ids_to_grain_ids[op].size();
+              affected_particles[op].assign(n_old_particles[op], 0);
+            }
+        }
+      else
+        {
+          // Order parameter indices stored per cell
+          op_particle_ids.reinit(n_order_params);
+          for (unsigned int b = 0; b < op_particle_ids.n_blocks(); ++b)
+            op_particle_ids.block(b).reinit(
+              tria.global_active_cell_index_partitioner().lock());
+
+          op_particle_ids = invalid_particle_id;
+
+          op_particle_centers.assign(n_order_params, {});
+          op_particle_radii.assign(n_order_params, {});
+        }
 
       particle_ids_to_grain_ids.clear();
       particle_ids_to_grain_ids.resize(n_order_params);
 
-      for (unsigned int current_order_parameter_id = 0;
-           current_order_parameter_id < n_order_params;
-           ++current_order_parameter_id)
-        {
-          auto &particle_ids =
-            op_particle_ids.block(current_order_parameter_id);
+      // step 1) run flooding for all order parameters in a single sweep and
+      // determine local particles and give them local ids
+      std::vector<unsigned int> counters(n_order_params, 0);
+      std::vector<unsigned int> offsets(n_order_params, 0);
 
-          // step 1) run flooding and determine local particles and give them
-          // local ids
-          particle_ids = invalid_particle_id;
+      {
+        ScopedName sc("run_flooding");
+        MyScope    scope(timer, sc, timer.is_enabled());
 
-          unsigned int counter = 0;
-          unsigned int offset  = 0;
+        const auto solution_order_parameters =
+          solution.create_view(order_parameters_offset,
+                               order_parameters_offset + n_order_params);
 
-          const auto &solution_order_parameter = solution.block(
-            current_order_parameter_id + order_parameters_offset);
+        const bool has_ghost_elements =
+          solution_order_parameters->has_ghost_elements();
 
-          {
-            ScopedName sc("run_flooding");
-            MyScope    scope(timer, sc, timer.is_enabled());
+        if (has_ghost_elements == false)
+          solution_order_parameters->update_ghost_values();
 
-            for (const auto &cell : dof_handler.active_cell_iterators())
+        // ... mark the cells covered by each order parameter so that the
+        // solution has to be accessed only once per cell
+        const double unvisited_particle_id = -2.0;
+
+        std::vector<std::pair<typename DoFHandler<dim>::active_cell_iterator,
+                              unsigned int>>
+          seeds;
+
+        // ... in the incremental mode, the particles of the neighbors of a
+        // cell that has become part of a particle are affected
+        const auto mark_neighbors = [&](const auto &cell, const auto op) {
+          const auto &particle_ids = op_particle_ids.block(op);
+
+          const auto mark = [&](const auto &neighbor) {
+            const auto particle_id =
+              particle_ids[neighbor->global_active_cell_index()];
+
+            if (particle_id >= 0)
+              affected_particles[op][static_cast<unsigned int>(particle_id)] =
+                1;
+          };
+
+          for (const auto face : cell->face_indices())
+            {
+              if (cell->at_boundary(face))
+                continue;
+
+              if (cell->neighbor(face)->has_children())
+                {
+                  for (unsigned int subface = 0;
+                       subface < GeometryInfo<dim>::n_subfaces(
+                                   internal::SubfaceCase<dim>::case_isotropic);
+                       ++subface)
+                    mark(cell->neighbor_child_on_subface(face, subface));
+                }
+              else
+                mark(cell->neighbor(face));
+            }
+        };
+
+        Vector<double> values(dof_handler.get_fe().n_dofs_per_cell());
+
+        for (const auto &cell : dof_handler.active_cell_iterators())
+          if (cell->is_locally_owned())
+            for (unsigned int op = 0; op < n_order_params; ++op)
               {
-                const bool has_ghost_elements =
-                  solution_order_parameter.has_ghost_elements();
-
-                if (has_ghost_elements == false)
-                  solution_order_parameter.update_ghost_values();
-
-                if (run_flooding<dim>(cell,
-                                      solution_order_parameter,
-                                      particle_ids,
-                                      counter,
-                                      threshold_lower,
-                                      invalid_particle_id) > 0)
-                  counter++;
-
-                if (has_ghost_elements == false)
-                  solution_order_parameter.zero_out_ghost_values();
+                cell->get_dof_values(solution_order_parameters->block(op),
+                                     values);
+
+                const bool has_particle =
+                  values.linfty_norm() >= threshold_lower;
+
+                auto &particle_id =
+                  op_particle_ids.block(op)[cell->global_active_cell_index()];
+
+                if (incremental && (particle_id != invalid_particle_id))
+                  {
+                    if (has_particle)
+                      continue; // cell is unchanged
+
+                    // cell is not part of its particle anymore
+                    affected_particles[op]
+                                      [static_cast<unsigned int>(particle_id)] =
+                                        1;
+                    particle_id = invalid_particle_id;
+                    continue;
+                  }
+
+                if (has_particle == false)
+                  continue; // cell has no particle
+
+                if (incremental)
+                  mark_neighbors(cell, op);
+
+                particle_id = unvisited_particle_id;
+                seeds.emplace_back(cell, op);
               }
+
+        if (has_ghost_elements == false)
+          solution_order_parameters->zero_out_ghost_values();
+
+        // ... relabel the remaining cells of the affected particles
+        if (incremental)
+          {
+            for (auto &affected : affected_particles)
+              Utilities::MPI::max(affected, comm, affected);
+
+            for (const auto &cell : dof_handler.active_cell_iterators())
+              if (cell->is_locally_owned())
+                for (unsigned int op = 0; op < n_order_params; ++op)
+                  {
+                    auto &particle_id = op_particle_ids.block(
+                      op)[cell->global_active_cell_index()];
+
+                    if ((particle_id >= 0) &&
+                        affected_particles[op]
+                                          [static_cast<unsigned int>(
+                                            particle_id)])
+                      {
+                        particle_id = unvisited_particle_id;
+                        seeds.emplace_back(cell, op);
+                      }
+                  }
           }
 
-          // step 2) determine the global number of locally determined particles
-          // and give each one an unique id by shifting the ids
-          MPI_Exscan(&counter, &offset, 1, MPI_UNSIGNED, MPI_SUM, comm);
+        // ... label the connected marked cells, all remaining cells count as
+        // visited
+        const auto is_particle = [](const auto &) { return true; };
 
-          for (auto &particle_id : particle_ids)
-            if (particle_id != invalid_particle_id)
-              particle_id += offset;
+        for (const auto &seed : seeds)
+          {
+            const unsigned int op = seed.second;
+
+            if (run_flooding_if<dim>(seed.first,
+                                     is_particle,
+                                     op_particle_ids.block(op),
+                                     n_old_particles[op] + counters[op],
+                                     unvisited_particle_id) > 0)
+              counters[op]++;
+          }
+      }
+
+      // step 2) determine the global number of locally determined particles
+      // and give each one an unique id by shifting the ids
+      MPI_Exscan(counters.data(),
+                 offsets.data(),
+                 n_order_params,
+                 MPI_UNSIGNED,
+                 MPI_SUM,
+                 comm);
+
+      for (unsigned int op = 0; op < n_order_params; ++op)
+        for (auto &particle_id : op_particle_ids.block(op))
+          if (particle_id != invalid_particle_id &&
+              particle_id >= n_old_particles[op])
+            particle_id += offsets[op];
+
+      // step 3) get particle ids on ghost cells (for all order parameters at
+      // once) and figure out if local particles and ghost particles might be
+      // one particle
+      op_particle_ids.update_ghost_values();
 
-          // step 3) get particle ids on ghost cells and figure out if local
-          // particles and ghost particles might be one particle
-          particle_ids.update_ghost_values();
+      for (unsigned int current_order_parameter_id = 0;
+           current_order_parameter_id < n_order_params;
+           ++current_order_parameter_id)
+        {
+          auto &particle_ids =
+            op_particle_ids.block(current_order_parameter_id);
+
+          const unsigned int counter = counters[current_order_parameter_id];
+          const unsigned int offset  = offsets[current_order_parameter_id];
+
+          // only newly labeled particles are stitched, the ids of the other
+          // ones are global already
+          const unsigned int n_old =
+            n_old_particles[current_order_parameter_id];
+          const auto &affected =
+            affected_particles[current_order_parameter_id];
+
+          const auto is_new_particle = [&](const double particle_id) {
+            return (particle_id != invalid_particle_id) &&
+                   (particle_id >= n_old);
+          };
 
           std::vector<std::vector<std::tuple<unsigned int, unsigned int>>>
             local_connectiviy(counter);
@@ -761,7 +975,7 @@ namespace GrainTracker
                 const auto particle_id =
                   particle_ids[ghost_cell->global_active_cell_index()];
 
-                if (particle_id == invalid_particle_id)
+                if (is_new_particle(particle_id) == false)
                   continue;
 
                 for (const auto face : ghost_cell->face_indices())
@@ -777,13 +991,14 @@ namespace GrainTracker
                       const auto neighbor_particle_id =
                         particle_ids[local_cell->global_active_cell_index()];
 
-                      if (neighbor_particle_id == invalid_particle_id)
+                      if (is_new_particle(neighbor_particle_id) == false)
                         return;
 
                       auto &temp =
-                        local_connectiviy[neighbor_particle_id - offset];
+                        local_connectiviy[neighbor_particle_id - n_old -
+                                          offset];
                       temp.emplace_back(ghost_cell->subdomain_id(),
-                                        particle_id);
+                                        particle_id - n_old);
                       std::sort(temp.begin(), temp.end());
                       temp.erase(std::unique(temp.begin(), temp.end()),
                                  temp.end());
@@ -819,25 +1034,48 @@ namespace GrainTracker
           }
 
           // step 5) determine properties of particles (volume, radius, center)
-          unsigned int n_particles = 0;
+          unsigned int n_new_particles = 0;
 
-          // ... determine the number of particles
+          // ... determine the number of newly labeled particles
           if (Utilities::MPI::sum(local_to_global_particle_ids.size(), comm) ==
               0)
-            n_particles = 0;
+            n_new_particles = 0;
           else
             {
-              n_particles =
+              n_new_particles =
                 (local_to_global_particle_ids.size() == 0) ?
                   0 :
                   *std::max_element(local_to_global_particle_ids.begin(),
                                     local_to_global_particle_ids.end());
-              n_particles = Utilities::MPI::max(n_particles, comm) + 1;
+              n_new_particles = Utilities::MPI::max(n_new_particles, comm) + 1;
             }
 
-          std::vector<double> particle_info(n_particles * (1 + dim));
+          // ... compact the ids of the previous particles that are kept
+          std::vector<unsigned int> kept_particle_ids(
+            n_old, numbers::invalid_unsigned_int);
+          unsigned int n_kept_particles = 0;
+          for (unsigned int i = 0; i < n_old; ++i)
+            if (affected[i] == 0)
+              kept_particle_ids[i] = n_kept_particles++;
+
+          const unsigned int n_particles = n_kept_particles + n_new_particles;
+
+          const auto get_unique_id = [&](const double particle_id) {
+            const auto id = static_cast<unsigned int>(particle_id);
+
+            if (id < n_old)
+              {
+                AssertIndexRange(kept_particle_ids[id], n_kept_particles);
+                return kept_particle_ids[id];
+              }
 
-          // ... compute local information
+            return n_kept_particles +
+                   local_to_global_particle_ids[id - n_old - offset];
+          };
+
+          std::vector<double> particle_info(n_new_particles * (1 + dim));
+
+          // ... compute local information of the new particles
           for (const auto &cell :
                dof_handler.get_triangulation().active_cell_iterators())
             if (cell->is_locally_owned())
@@ -845,13 +1083,13 @@ namespace GrainTracker
                 const auto particle_id =
                   particle_ids[cell->global_active_cell_index()];
 
-                if (particle_id == invalid_particle_id)
+                if (is_new_particle(particle_id) == false)
                   continue;
 
-                const unsigned int unique_id = local_to_global_particle_ids
-                  [static_cast<unsigned int>(particle_id) - offset];
+                const unsigned int unique_id =
+                  get_unique_id(particle_id) - n_kept_particles;
 
-                AssertIndexRange(unique_id, n_particles);
+                AssertIndexRange(unique_id, n_new_particles);
 
                 particle_info[(dim + 1) * unique_id + 0] += cell->measure();
 
@@ -868,20 +1106,31 @@ namespace GrainTracker
                         MPI_SUM,
                         comm);
 
-          // ... compute particles centers
+          // ... compute particles centers (kept particles reuse the
+          // previous ones)
           std::vector<Point<dim>> particle_centers(n_particles);
-          for (unsigned int i = 0; i < n_particles; i++)
+          std::vector<double>     particle_radii(n_particles, 0.);
+
+          for (unsigned int i = 0; i < n_old; ++i)
+            if (kept_particle_ids[i] != numbers::invalid_unsigned_int)
+              {
+                particle_centers[kept_particle_ids[i]] =
+                  op_particle_centers[current_order_parameter_id][i];
+                particle_radii[kept_particle_ids[i]] =
+                  op_particle_radii[current_order_parameter_id][i];
+              }
+
+          for (unsigned int i = 0; i < n_new_particles; i++)
             {
               for (unsigned int d = 0; d < dim; ++d)
                 {
-                  particle_centers[i][d] =
+                  particle_centers[n_kept_particles + i][d] =
                     particle_info[i * (1 + dim) + 1 + d] /
                     particle_info[i * (1 + dim)];
                 }
             }
 
           // ... compute particles radii
-          std::vector<double> particle_radii(n_particles, 0.);
           for (const auto &cell :
                dof_handler.get_triangulation().active_cell_iterators())
             if (cell->is_locally_owned())
@@ -889,11 +1138,10 @@ namespace GrainTracker
                 const auto particle_id =
                   particle_ids[cell->global_active_cell_index()];
 
-                if (particle_id == invalid_particle_id)
+                if (is_new_particle(particle_id) == false)
                   continue;
 
-                const unsigned int unique_id = local_to_global_particle_ids
-                  [static_cast<unsigned int>(particle_id) - offset];
+                const unsigned int unique_id = get_unique_id(particle_id);
 
                 AssertIndexRange(unique_id, n_particles);
 
@@ -907,17 +1155,20 @@ namespace GrainTracker
 
           // ... reduce information
           MPI_Allreduce(MPI_IN_PLACE,
-                        particle_radii.data(),
-                        particle_radii.size(),
+                        particle_radii.data() + n_kept_particles,
+                        n_new_particles,
                         MPI_DOUBLE,
                         MPI_MAX,
                         comm);
 
+          // ... store the geometry for the next incremental call
+          op_particle_centers[current_order_parameter_id] = particle_centers;
+          op_particle_radii[current_order_parameter_id]   = particle_radii;
+
           // Set global ids to the particles
           for (auto &particle_id : particle_ids)
             if (particle_id != invalid_particle_id)
-              particle_id = local_to_global_particle_ids
-                [static_cast<unsigned int>(particle_id) - offset];
+              particle_id = get_unique_id(particle_id);
           particle_ids.update_ghost_values();
 
           // Build periodicity between particles
@@ -1052,6 +1303,8 @@ namespace GrainTracker
             }
         }
 
+      labels_up_to_date = true;
+
       return new_grains;
     }
 
@@ -1119,57 +1372,86 @@ namespace GrainTracker
 
       std::set<unsigned int> remap_candidates;
 
+      /* Index the segments of all grains. The boxes are enlarged by the
+       * buffer zones such that only grains with intersecting boxes can be
+       * too close to each other.
+       */
+      const auto buffer_extension = [&](const Grain<dim> &grain) {
+        return buffer_distance_ratio * grain.get_max_radius() +
+               std::max(buffer_distance_fixed, 0.0) / 2.0;
+      };
+
+      std::vector<BoundingBox<dim>> segments_boxes;
+      std::vector<unsigned int>     segments_grain_ids;
+      for (const auto &[gid, gr] : grains)
+        for (const auto &segment : gr.get_segments())
+          {
+            segments_boxes.push_back(
+              segment.bounding_box(buffer_extension(gr)));
+            segments_grain_ids.push_back(gid);
+          }
+
+      const auto segments_tree = pack_rtree_of_indices(segments_boxes);
+
       // Base grain to compare with
       for (auto &[g_base_id, gr_base] : grains)
         {
+          std::set<unsigned int> other_ids;
+          for (const auto &segment : gr_base.get_segments())
+            for (const auto i :
+                 segments_tree |
+                   boost::geometry::index::adaptors::queried(
+                     boost::geometry::index::intersects(
+                       segment.bounding_box(buffer_extension(gr_base)))))
+              if (segments_grain_ids[i] > g_base_id)
+                other_ids.insert(segments_grain_ids[i]);
+
           // Secondary grain
-          for (auto &[g_other_id, gr_other] : grains)
+          for (const auto g_other_id : other_ids)
             {
-              if (g_other_id > g_base_id)
+              const auto &gr_other = grains.at(g_other_id);
+
+              // Minimum distance between the two grains
+              double min_distance = gr_base.distance(gr_other);
+
+              /* Buffer safety zone around the two grains. If an overlap
+               * is detected, then the old order parameter values of all
+               * the cells inside the buffer zone are transfered to a
+               * new one.
+               */
+              const double buffer_distance_base =
+                buffer_distance_ratio * gr_base.get_max_radius();
+              const double buffer_distance_other =
+                buffer_distance_ratio * gr_other.get_max_radius();
+
+              /* If two grains sharing the same order parameter are
+               * too close to each other, then try to change the
+               * order parameter of the secondary grain
+               */
+              if (min_distance < buffer_distance_base +
+                                   buffer_distance_other +
+                                   buffer_distance_fixed)
                 {
-                  // Minimum distance between the two grains
-                  double min_distance = gr_base.distance(gr_other);
-
-                  /* Buffer safety zone around the two grains. If an overlap
-                   * is detected, then the old order parameter values of all
-                   * the cells inside the buffer zone are transfered to a
-                   * new one.
-                   */
-                  const double buffer_distance_base =
-                    buffer_distance_ratio * gr_base.get_max_radius();
-                  const double buffer_distance_other =
-                    buffer_distance_ratio * gr_other.get_max_radius();
-
-                  /* If two grains sharing the same order parameter are
-                   * too close to each other, then try to change the
-                   * order parameter of the secondary grain
-                   */
-                  if (min_distance < buffer_distance_base +
-                                       buffer_distance_other +
-                                       buffer_distance_fixed)
-                    {
-                      dsp.add(grains_to_sparsity.at(g_base_id),
-                              grains_to_sparsity.at(g_other_id));
+                  dsp.add(grains_to_sparsity.at(g_base_id),
+                          grains_to_sparsity.at(g_other_id));
 
-                      // Exploit symmetry
-                      dsp.add(grains_to_sparsity.at(g_other_id),
-                              grains_to_sparsity.at(g_base_id));
+                  // Exploit symmetry
+                  dsp.add(grains_to_sparsity.at(g_other_id),
+                          grains_to_sparsity.at(g_base_id));
 
-                      if (gr_other.get_order_parameter_id() ==
-                          gr_base.get_order_parameter_id())
-                        {
-                          std::ostringstream ss;
-                          ss << "Found an overlap between grain "
-                             << gr_base.get_grain_id() << " and grain "
-                             << gr_other.get_grain_id()
-                             << " with order parameter "
-                             << gr_base.get_order_parameter_id() << std::endl;
+                  if (gr_other.get_order_parameter_id() ==
+                      gr_base.get_order_parameter_id())
+                    {
+                      std::ostringstream ss;
+                      ss << "Found an overlap between grain "
+                         << gr_base.get_grain_id() << " and grain "
+                         << gr_other.get_grain_id()
+                         << " with order parameter "
+                         << gr_base.get_order_parameter_id() << std::endl;
 
-                          log.emplace_back(ss.str());
+                      log.emplace_back(ss.str());
 
-                          remap_candidates.insert(
-                            grains_to_sparsity.at(g_other_id));
-                        }
+                      remap_candidates.insert(grains_to_sparsity.at(g_other_id));
                     }
                 }
             }
@@ -1310,22 +1592,72 @@ namespace GrainTracker
        * closest or not) we use neighbors from different states for computing
        * the distance to the nearest one when determining the safe trasfer
        * buffer zone for remapping.
+       *
+       * The segments tree is traversed in the order of the distance of the
+       * boxes to the center of a segment of the base grain. Since each box
+       * contains the center of its segment, this distance minus the radii
+       * bounds the distance between the segments from below, and the
+       * traversal stops once no closer neighbor can be found.
        */
+      double max_segment_radius = 0.0;
+      for (const auto &[gid, gr] : grains)
+        {
+          (void)gid;
+          max_segment_radius =
+            std::max(max_segment_radius, gr.get_max_radius());
+        }
+
+      const auto distance_to_box = [](const Point<dim> &      point,
+                                      const BoundingBox<dim> &box) {
+        double distance_sqr = 0.0;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            const double delta =
+              std::max({box.get_boundary_points().first[d] - point[d],
+                        0.0,
+                        point[d] - box.get_boundary_points().second[d]});
+            distance_sqr += delta * delta;
+          }
+        return std::sqrt(distance_sqr);
+      };
+
       for (auto &[g_base_id, gr_base] : grains)
         {
-          (void)g_base_id;
-          for (const auto &[g_other_id, gr_other] : grains)
-            {
-              (void)g_other_id;
-              if (gr_base.get_grain_id() != gr_other.get_grain_id() &&
-                  (gr_base.get_order_parameter_id() ==
-                     gr_other.get_order_parameter_id() ||
-                   gr_base.get_old_order_parameter_id() ==
-                     gr_other.get_old_order_parameter_id()))
-                {
-                  gr_base.add_neighbor(gr_other);
-                }
-            }
+          double min_distance = std::numeric_limits<double>::max();
+
+          std::set<unsigned int> visited_ids;
+
+          for (const auto &segment : gr_base.get_segments())
+            for (auto it = segments_tree.qbegin(
+                   boost::geometry::index::nearest(segment.get_center(),
+                                                   segments_tree.size()));
+                 it != segments_tree.qend();
+                 ++it)
+              {
+                if (distance_to_box(segment.get_center(), segments_boxes[*it]) -
+                      segment.get_radius() - max_segment_radius >=
+                    min_distance)
+                  break;
+
+                const unsigned int g_other_id = segments_grain_ids[*it];
+
+                if (g_other_id == g_base_id ||
+                    visited_ids.insert(g_other_id).second == false)
+                  continue;
+
+                const auto &gr_other = grains.at(g_other_id);
+
+                if (gr_base.get_order_parameter_id() ==
+                      gr_other.get_order_parameter_id() ||
+                    gr_base.get_old_order_parameter_id() ==
+                      gr_other.get_old_order_parameter_id())
+                  {
+                    gr_base.add_neighbor(gr_other);
+
+                    min_distance =
+                      std::min(min_distance, gr_base.distance(gr_other));
+                  }
+              }
         }
 
       // Remove dangling order parameters if any
@@ -1647,6 +1979,13 @@ namespace GrainTracker
     // Distributed vector of particle ids
     BlockVectorType op_particle_ids;
 
+    // Centers and radii of the particles of each order parameter
+    std::vector<std::vector<Point<dim>>> op_particle_centers;
+    std::vector<std::vector<double>>     op_particle_radii;
+
+    // Are the particle ids consistent with the current solution layout
+    mutable bool labels_up_to_date = false;
+
     // Mapping to find grain from particle id over the order paramter
     std::vector<std::vector<std::pair<unsigned int, unsigned int>>>
       particle_ids_to_grain_ids;
@@ -1682,6 +2021,9 @@ namespace GrainTracker
     // Order parameters offset in FESystem
     const unsigned int order_parameters_offset;
 
+    // Relabel only the cells that have changed during tracking
+    const bool incremental;
+
     // Total number of segments
     unsigned int n_total_segments;
 
@@ -3,6 +3,7 @@
 #include <deal.II/lac/block_vector_base.h>
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/vector_operation.h>
+#include <deal.II/lac/vector_operations_internal.h>
 
 #include <pf-applications/base/memory_consumption.h>
 
@@ -24,19 +25,22 @@ namespace dealii
          * Initialization.
          */
         explicit DynamicBlockVector(const unsigned int n = 0)
-          : size_(0)
+          : fused_communication(false)
+          , size_(0)
         {
           reinit(n);
         }
 
         explicit DynamicBlockVector(const DynamicBlockVector<T> &V)
-          : size_(0)
+          : fused_communication(false)
+          , size_(0)
         {
           *this = V;
         }
 
         template <typename Iterator>
         explicit DynamicBlockVector(Iterator begin, Iterator end)
+          : fused_communication(false)
         {
           blocks.assign(begin, end);
           block_counter = blocks.size();
@@ -49,7 +53,8 @@ namespace dealii
         DynamicBlockVector<T> &
         operator=(const DynamicBlockVector<T> &V)
         {
-          block_counter = V.n_blocks();
+          fused_communication = V.fused_communication;
+          block_counter       = V.n_blocks();
           blocks.resize(n_blocks());
 
           for (unsigned int b = 0; b < n_blocks(); ++b)
@@ -97,7 +102,8 @@ namespace dealii
         reinit(const DynamicBlockVector<T> &V,
                const bool                   omit_zeroing_entries = false)
         {
-          block_counter = V.n_blocks();
+          fused_communication = V.fused_communication;
+          block_counter       = V.n_blocks();
           blocks.resize(n_blocks());
 
           for (unsigned int b = 0; b < n_blocks(); ++b)
@@ -136,6 +142,8 @@ namespace dealii
 
           const_cast<DynamicBlockVector<T> *>(view.get())->block_counter =
             view->blocks.size();
+          const_cast<DynamicBlockVector<T> *>(view.get())
+            ->fused_communication = fused_communication;
 
           return view;
         }
@@ -151,7 +159,8 @@ namespace dealii
           for (unsigned int i = start; i < end; ++i)
             view->blocks.push_back(blocks[i]);
 
-          view->block_counter = view->blocks.size();
+          view->block_counter       = view->blocks.size();
+          view->fused_communication = fused_communication;
 
           return view;
         }
@@ -193,6 +202,12 @@ namespace dealii
           return block_counter;
         }
 
+        MPI_Comm
+        get_mpi_communicator() const
+        {
+          return block(0).get_mpi_communicator();
+        }
+
         /* Move block to a new place */
         void
         move_block(const unsigned int from, const unsigned int to)
@@ -212,14 +227,54 @@ namespace dealii
           blocks[to] = tmp;
         }
 
+        /**
+         * Fuse the ghost exchange of all blocks sharing a partitioner into a
+         * single message per neighbor and the global reductions of all
+         * blocks into a single MPI_Allreduce. The setting is inherited by
+         * vectors initialized from this one and by its views.
+         */
+        void
+        set_fused_communication(const bool flag)
+        {
+          fused_communication = flag;
+        }
+
+        bool
+        use_fused_communication() const
+        {
+          return fused_communication;
+        }
+
         /**
          * Communication.
          */
         void
         update_ghost_values() const
         {
-          for (unsigned int b = 0; b < n_blocks(); ++b)
-            block(b).update_ghost_values();
+          if (use_fused_communication() && n_blocks() > 1 &&
+              blocks_share_partitioner() &&
+              has_plain_ghost_layout(*block(0).get_partitioner()))
+            {
+              update_ghost_values_fused();
+              return;
+            }
+
+          // start the exchange of a chunk of blocks before waiting for any
+          // of them so that the messages of all blocks overlap
+          constexpr unsigned int communication_block_size = 20;
+
+          for (unsigned int start = 0; start < n_blocks();
+               start += communication_block_size)
+            {
+              const unsigned int end =
+                std::min(start + communication_block_size, n_blocks());
+
+              for (unsigned int b = start; b < end; ++b)
+                block(b).update_ghost_values_start(b - start);
+
+              for (unsigned int b = start; b < end; ++b)
+                block(b).update_ghost_values_finish();
+            }
         }
 
         void
@@ -267,6 +322,19 @@ namespace dealii
         T
         l2_norm() const
         {
+          if (use_fused_communication() && n_blocks() > 0)
+            {
+              T result = 0.0;
+              for (unsigned int b = 0; b < n_blocks(); ++b)
+                {
+                  dealii::internal::VectorOperations::Norm2<T, T> norm2(
+                    block(b).begin());
+                  result += reduce_local(norm2, block(b));
+                }
+              return std::sqrt(
+                Utilities::MPI::sum(result, get_mpi_communicator()));
+            }
+
           T result = 0.0;
           for (unsigned int b = 0; b < n_blocks(); ++b)
             result += std::pow(block(b).l2_norm(), 2.0);
@@ -276,6 +344,18 @@ namespace dealii
         T
         l1_norm() const
         {
+          if (use_fused_communication() && n_blocks() > 0)
+            {
+              T result = 0.0;
+              for (unsigned int b = 0; b < n_blocks(); ++b)
+                {
+                  dealii::internal::VectorOperations::Norm1<T, T> norm1(
+                    block(b).begin());
+                  result += reduce_local(norm1, block(b));
+                }
+              return Utilities::MPI::sum(result, get_mpi_communicator());
+            }
+
           T result = 0.0;
           for (unsigned int b = 0; b < n_blocks(); ++b)
             result += block(b).l1_norm();
@@ -285,6 +365,19 @@ namespace dealii
         T
         linfty_norm() const
         {
+          if (use_fused_communication() && n_blocks() > 0)
+            {
+              T result = 0.0;
+              for (unsigned int b = 0; b < n_blocks(); ++b)
+                {
+                  const T *values = block(b).begin();
+                  for (unsigned int i = 0; i < block(b).locally_owned_size();
+                       ++i)
+                    result = std::max<T>(result, std::abs(values[i]));
+                }
+              return Utilities::MPI::max(result, get_mpi_communicator());
+            }
+
           T result = 0.0;
           for (unsigned int b = 0; b < n_blocks(); ++b)
             result = std::max<T>(result, block(b).linfty_norm());
@@ -359,12 +452,102 @@ namespace dealii
           AssertDimension(n_blocks(), V.n_blocks());
           AssertDimension(n_blocks(), W.n_blocks());
 
+          if (use_fused_communication() && n_blocks() > 0)
+            {
+              T result = 0.0;
+              for (unsigned int b = 0; b < n_blocks(); ++b)
+                {
+                  dealii::internal::VectorOperations::AddAndDot<T> adder(
+                    block(b).begin(),
+                    V.block(b).begin(),
+                    W.block(b).begin(),
+                    a);
+                  result += reduce_local(adder, block(b));
+                }
+              return Utilities::MPI::sum(result, get_mpi_communicator());
+            }
+
           T result = 0.0;
           for (unsigned int b = 0; b < n_blocks(); ++b)
             result += block(b).add_and_dot(a, V.block(b), W.block(b));
           return result;
         }
 
+        /**
+         * Compute the dot products of this vector with all vectors of @p V
+         * in a single pass over the data and with a single reduction.
+         */
+        std::vector<T>
+        multi_dot(const std::vector<const DynamicBlockVector<T> *> &V) const
+        {
+          auto result = multi_dot_local(V);
+
+          if (n_blocks() > 0)
+            Utilities::MPI::sum(result, get_mpi_communicator(), result);
+
+          return result;
+        }
+
+        /**
+         * Same as multi_dot() but only with the contributions of the locally
+         * owned entries, so that the reduction can be performed by the
+         * caller, e.g., non-blocking.
+         */
+        std::vector<T>
+        multi_dot_local(
+          const std::vector<const DynamicBlockVector<T> *> &V) const
+        {
+          std::vector<T> result(V.size(), 0.0);
+
+          for (unsigned int b = 0; b < n_blocks(); ++b)
+            {
+              const T *         values = block(b).begin();
+              const std::size_t size   = block(b).locally_owned_size();
+
+              for (std::size_t start = 0; start < size;
+                   start += fused_chunk_size)
+                {
+                  const std::size_t end =
+                    std::min<std::size_t>(start + fused_chunk_size, size);
+
+                  for (unsigned int j = 0; j < V.size(); ++j)
+                    {
+                      const T *values_v = V[j]->block(b).begin();
+
+                      T sum = 0.0;
+                      for (std::size_t i = start; i < end; ++i)
+                        sum += values[i] * values_v[i];
+                      result[j] += sum;
+                    }
+                }
+            }
+
+          return result;
+        }
+
+        /**
+         * Add the linear combination of the vectors of @p V with the given
+         * coefficients in a single pass over the data.
+         */
+        void
+        multi_add(const std::vector<T> &                            a,
+                  const std::vector<const DynamicBlockVector<T> *> &V)
+        {
+          multi_add_internal(a, V, false);
+        }
+
+        /**
+         * Same as multi_add(), but also return the l2 norm of the updated
+         * vector.
+         */
+        T
+        multi_add_and_l2_norm(
+          const std::vector<T> &                            a,
+          const std::vector<const DynamicBlockVector<T> *> &V)
+        {
+          return multi_add_internal(a, V, true);
+        }
+
         void
         operator=(const T &v)
         {
@@ -377,14 +560,27 @@ namespace dealii
         {
           AssertDimension(n_blocks(), V.n_blocks());
 
+          if (use_fused_communication() && n_blocks() > 0)
+            {
+              T result = 0.0;
+              for (unsigned int b = 0; b < n_blocks(); ++b)
+                {
+                  dealii::internal::VectorOperations::Dot<T, T> dot(
+                    block(b).begin(), V.block(b).begin());
+                  result += reduce_local(dot, block(b));
+                }
+              return Utilities::MPI::sum(result, get_mpi_communicator());
+            }
+
           T result = 0.0;
           for (unsigned int b = 0; b < n_blocks(); ++b)
             result += block(b) * V.block(b);
           return result;
         }
 
+        template <typename T2>
         void
-        copy_locally_owned_data_from(const DynamicBlockVector<T> &V)
+        copy_locally_owned_data_from(const DynamicBlockVector<T2> &V)
         {
           AssertDimension(n_blocks(), V.n_blocks());
           for (unsigned int b = 0; b < n_blocks(); ++b)
@@ -400,15 +596,233 @@ namespace dealii
         void
         swap(DynamicBlockVector &V)
         {
+          std::swap(this->fused_communication, V.fused_communication);
           std::swap(this->block_counter, V.block_counter);
           std::swap(this->blocks, V.blocks);
           std::swap(this->size_, V.size_);
         }
 
       private:
+        // number of entries processed at once by the multi-vector kernels,
+        // so that the entries of this vector remain in cache
+        static constexpr std::size_t fused_chunk_size = 256;
+
+        T
+        multi_add_internal(const std::vector<T> &                            a,
+                           const std::vector<const DynamicBlockVector<T> *> &V,
+                           const bool compute_norm)
+        {
+          AssertDimension(a.size(), V.size());
+
+          T norm_sqr = 0.0;
+
+          for (unsigned int b = 0; b < n_blocks(); ++b)
+            {
+              T *               values = blocks[b]->begin();
+              const std::size_t size   = block(b).locally_owned_size();
+
+              for (std::size_t start = 0; start < size;
+                   start += fused_chunk_size)
+                {
+                  const std::size_t end =
+                    std::min<std::size_t>(start + fused_chunk_size, size);
+
+                  for (unsigned int j = 0; j < V.size(); ++j)
+                    {
+                      const T *values_v = V[j]->block(b).begin();
+                      const T  a_j      = a[j];
+
+                      for (std::size_t i = start; i < end; ++i)
+                        values[i] += a_j * values_v[i];
+                    }
+
+                  if (compute_norm)
+                    for (std::size_t i = start; i < end; ++i)
+                      norm_sqr += values[i] * values[i];
+                }
+            }
+
+          if (compute_norm == false || n_blocks() == 0)
+            return 0.0;
+
+          return std::sqrt(
+            Utilities::MPI::sum(norm_sqr, get_mpi_communicator()));
+        }
+
+        /* Reduce the locally owned entries of a block with the vectorized and
+         * threaded kernels of deal.II, the global reduction is done by the
+         * caller for all blocks at once.
+         */
+        template <typename Operation>
+        T
+        reduce_local(const Operation &op, const BlockType &block) const
+        {
+          T result = 0.0;
+          dealii::internal::VectorOperations::parallel_reduce(
+            op, 0, block.locally_owned_size(), result, thread_loop_partitioner);
+          return result;
+        }
+
+        /* The fused ghost exchange writes the ghost values contiguously after
+         * the locally owned entries. Partitioners whose ghost indices are
+         * embedded into a larger ghost set with gaps are handled block by
+         * block.
+         */
+        static bool
+        has_plain_ghost_layout(const Utilities::MPI::Partitioner &partitioner)
+        {
+          const auto &ranges =
+            partitioner.ghost_indices_within_larger_ghost_set();
+
+          if (ranges.empty())
+            return true;
+
+          // without a larger ghost set, the range starts after the locally
+          // owned entries
+          const unsigned int start = ranges.front().first;
+          if (start != 0 && start != partitioner.locally_owned_size())
+            return false;
+
+          unsigned int next = start;
+          for (const auto &[begin, end] : ranges)
+            {
+              if (begin != next)
+                return false;
+              next = end;
+            }
+
+          return next - start == partitioner.n_ghost_indices();
+        }
+
+        bool
+        blocks_share_partitioner() const
+        {
+          for (unsigned int b = 1; b < n_blocks(); ++b)
+            if (block(b).get_partitioner().get() !=
+                block(0).get_partitioner().get())
+              return false;
+
+          return true;
+        }
+
+        /* Exchange the ghost values of all blocks with one message per
+         * neighbor. The messages are laid out block by block and use the
+         * import and ghost targets of the common partitioner.
+         */
+        void
+        update_ghost_values_fused() const
+        {
+#ifdef DEAL_II_WITH_MPI
+          const auto &partitioner = *block(0).get_partitioner();
+          const auto  comm        = partitioner.get_mpi_communicator();
+
+          const unsigned int n_blocks_ = n_blocks();
+          const unsigned int n_owned   = partitioner.locally_owned_size();
+
+          std::vector<T> import_data(n_blocks_ *
+                                     partitioner.n_import_indices());
+          std::vector<T> ghost_data(n_blocks_ * partitioner.n_ghost_indices());
+
+          std::vector<MPI_Request> requests;
+          requests.reserve(partitioner.ghost_targets().size() +
+                           partitioner.import_targets().size());
+
+          const int tag =
+            Utilities::MPI::internal::Tags::partitioner_export_start;
+
+          // post receives of the ghost values
+          unsigned int offset = 0;
+          for (const auto &[rank, n_indices] : partitioner.ghost_targets())
+            {
+              requests.emplace_back();
+              const int ierr =
+                MPI_Irecv(ghost_data.data() + n_blocks_ * offset,
+                          n_blocks_ * n_indices,
+                          Utilities::MPI::mpi_type_id_for_type<T>,
+                          rank,
+                          tag,
+                          comm,
+                          &requests.back());
+              AssertThrowMPI(ierr);
+              offset += n_indices;
+            }
+
+          // pack the values of all blocks requested by a neighbor and send
+          // them
+          const auto &import_indices = partitioner.import_indices();
+          auto        ranges_begin   = import_indices.begin();
+          offset                     = 0;
+          for (const auto &[rank, n_indices] : partitioner.import_targets())
+            {
+              auto         ranges_end = ranges_begin;
+              unsigned int counter    = 0;
+              while (counter < n_indices)
+                {
+                  counter += ranges_end->second - ranges_end->first;
+                  ++ranges_end;
+                }
+
+              T *buffer = import_data.data() + n_blocks_ * offset;
+              for (unsigned int b = 0; b < n_blocks_; ++b)
+                {
+                  const T *values = block(b).begin();
+                  for (auto range = ranges_begin; range != ranges_end;
+                       ++range)
+                    for (unsigned int i = range->first; i < range->second;
+                         ++i)
+                      *(buffer++) = values[i];
+                }
+
+              requests.emplace_back();
+              const int ierr =
+                MPI_Isend(import_data.data() + n_blocks_ * offset,
+                          n_blocks_ * n_indices,
+                          Utilities::MPI::mpi_type_id_for_type<T>,
+                          rank,
+                          tag,
+                          comm,
+                          &requests.back());
+              AssertThrowMPI(ierr);
+
+              ranges_begin = ranges_end;
+              offset += n_indices;
+            }
+
+          const int ierr =
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+
+          // unpack the ghost values
+          offset = 0;
+          for (const auto &[rank, n_indices] : partitioner.ghost_targets())
+            {
+              (void)rank;
+
+              const T *buffer = ghost_data.data() + n_blocks_ * offset;
+              for (unsigned int b = 0; b < n_blocks_; ++b)
+                {
+                  T *values = blocks[b]->begin() + n_owned + offset;
+                  for (unsigned int i = 0; i < n_indices; ++i)
+                    values[i] = *(buffer++);
+                }
+
+              offset += n_indices;
+            }
+#endif
+
+          for (unsigned int b = 0; b < n_blocks(); ++b)
+            block(b).set_ghost_state(true);
+        }
+
+        bool                                    fused_communication;
         unsigned int                            block_counter;
         std::vector<std::shared_ptr<BlockType>> blocks;
 
+        // partitioner of the threads of the local reductions
+        std::shared_ptr<parallel::internal::TBBPartitioner>
+          thread_loop_partitioner =
+            std::make_shared<parallel::internal::TBBPartitioner>();
+
         types::global_dof_index size_;
       };
     } // namespace distributed
@@ -18,6 +18,9 @@
 
 #include <pf-applications/numerics/vector_tools.h>
 
+#include <Epetra_MultiVector.h>
+#include <Teuchos_ParameterList.hpp>
+
 namespace Preconditioners
 {
   using namespace dealii;
@@ -536,6 +539,76 @@ namespace Preconditioners
 
 
 
+  namespace internal
+  {
+    /* Trilinos ML preconditioner that can keep its aggregates as long as
+     * the sparsity pattern of the matrix does not change. In this case,
+     * only the prolongators, the Galerkin products, and the smoothers are
+     * recomputed. The hierarchy is rebuilt from scratch after the matrix
+     * has been recreated (AMR, change of the number of components).
+     */
+    class PreconditionAMGWithReuse : public TrilinosWrappers::PreconditionAMG
+    {
+    public:
+      void
+      initialize(const TrilinosWrappers::SparseMatrix &matrix,
+                 const AdditionalData &                additional_data,
+                 const bool                            reuse_hierarchy)
+      {
+        if (reuse_hierarchy && has_hierarchy_for(matrix))
+          {
+            TrilinosWrappers::PreconditionAMG::reinit();
+            return;
+          }
+
+        Teuchos::ParameterList parameter_list;
+        additional_data.set_parameters(parameter_list,
+                                       constant_modes,
+                                       matrix);
+
+        // keep the aggregates so that they can be reused by reinit()
+        if (reuse_hierarchy)
+          parameter_list.set("reuse: enable", true);
+
+        TrilinosWrappers::PreconditionAMG::initialize(matrix, parameter_list);
+
+        matrix_ptr = &matrix.trilinos_matrix();
+        n_rows     = matrix.m();
+        n_nonzeros = matrix.n_nonzero_elements();
+      }
+
+      void
+      clear()
+      {
+        TrilinosWrappers::PreconditionAMG::clear();
+
+        constant_modes.reset();
+        matrix_ptr = nullptr;
+      }
+
+    private:
+      bool
+      has_hierarchy_for(const TrilinosWrappers::SparseMatrix &matrix) const
+      {
+        const bool same_matrix = matrix_ptr == &matrix.trilinos_matrix() &&
+                                 n_rows == matrix.m() &&
+                                 n_nonzeros == matrix.n_nonzero_elements();
+
+        // the decision has to be the same on all processes
+        return Utilities::MPI::min(static_cast<unsigned int>(same_matrix),
+                                   matrix.get_mpi_communicator()) == 1;
+      }
+
+      std::unique_ptr<Epetra_MultiVector> constant_modes;
+
+      const Epetra_CrsMatrix *matrix_ptr = nullptr;
+      types::global_dof_index n_rows     = 0;
+      std::size_t             n_nonzeros = 0;
+    };
+  } // namespace internal
+
+
+
   template <typename Operator>
   class AMG : public PreconditionerBase<typename Operator::value_type>
   {
@@ -543,12 +616,14 @@ namespace Preconditioners
     using VectorType      = typename Operator::VectorType;
     using BlockVectorType = typename PreconditionerBase<
       typename Operator::value_type>::BlockVectorType;
+    using AdditionalData = TrilinosWrappers::PreconditionAMG::AdditionalData;
 
-    AMG(const Operator &op,
-        const TrilinosWrappers::PreconditionAMG::AdditionalData &
-          additional_data = TrilinosWrappers::PreconditionAMG::AdditionalData())
+    AMG(const Operator &      op,
+        const AdditionalData &additional_data = AdditionalData(),
+        const bool            reuse_hierarchy = false)
       : op(op)
       , additional_data(additional_data)
+      , reuse_hierarchy(reuse_hierarchy)
     {}
 
     virtual void
@@ -590,7 +665,9 @@ namespace Preconditioners
     {
       MyScope scope(timer, "amg::setup");
 
-      precondition_amg.initialize(op.get_system_matrix(), additional_data);
+      precondition_amg.initialize(op.get_system_matrix(),
+                                  additional_data,
+                                  reuse_hierarchy);
     }
 
     virtual std::size_t
@@ -604,7 +681,8 @@ namespace Preconditioners
     const Operator &op;
 
     TrilinosWrappers::PreconditionAMG::AdditionalData additional_data;
-    TrilinosWrappers::PreconditionAMG                 precondition_amg;
+    const bool                                        reuse_hierarchy;
+    internal::PreconditionAMGWithReuse                precondition_amg;
 
     mutable MyTimerOutput timer;
 
@@ -620,13 +698,14 @@ namespace Preconditioners
     using VectorType      = typename Operator::VectorType;
     using BlockVectorType = typename PreconditionerBase<
       typename Operator::value_type>::BlockVectorType;
+    using AdditionalData = TrilinosWrappers::PreconditionAMG::AdditionalData;
 
-    BlockAMG(
-      const Operator &                                         op,
-      const TrilinosWrappers::PreconditionAMG::AdditionalData &additional_data =
-        TrilinosWrappers::PreconditionAMG::AdditionalData())
+    BlockAMG(const Operator &      op,
+             const AdditionalData &additional_data = AdditionalData(),
+             const bool            reuse_hierarchy = false)
       : op(op)
       , additional_data(additional_data)
+      , reuse_hierarchy(reuse_hierarchy)
     {}
 
     virtual void
@@ -659,13 +738,20 @@ namespace Preconditioners
 
       const auto &block_matrix = op.get_block_system_matrix();
 
-      precondition_amg.resize(block_matrix.size());
-      for (unsigned int b = 0; b < block_matrix.size(); ++b)
+      // the hierarchies of the blocks can only be reused if the number of
+      // blocks has not changed
+      if (reuse_hierarchy == false ||
+          precondition_amg.size() != block_matrix.size())
         {
-          precondition_amg[b] =
-            std::make_shared<TrilinosWrappers::PreconditionAMG>();
-          precondition_amg[b]->initialize(*block_matrix[b], additional_data);
+          precondition_amg.resize(block_matrix.size());
+          for (auto &amg : precondition_amg)
+            amg = std::make_shared<internal::PreconditionAMGWithReuse>();
         }
+
+      for (unsigned int b = 0; b < block_matrix.size(); ++b)
+        precondition_amg[b]->initialize(*block_matrix[b],
+                                        additional_data,
+                                        reuse_hierarchy);
     }
 
     virtual std::size_t
@@ -678,7 +764,8 @@ namespace Preconditioners
     const Operator &op;
 
     TrilinosWrappers::PreconditionAMG::AdditionalData additional_data;
-    std::vector<std::shared_ptr<TrilinosWrappers::PreconditionAMG>>
+    const bool                                        reuse_hierarchy;
+    std::vector<std::shared_ptr<internal::PreconditionAMGWithReuse>>
       precondition_amg;
 
     mutable MyTimerOutput timer;
@@ -1174,12 +1261,15 @@ namespace Preconditioners
   std::unique_ptr<PreconditionerBase<typename T::value_type>>
   create(const T &                                          op,
          const std::string &                                label,
-         TrilinosWrappers::PreconditionAMG::AdditionalData &additional_data)
+         TrilinosWrappers::PreconditionAMG::AdditionalData &additional_data,
+         const bool reuse_hierarchy = false)
   {
     if (label == "AMG")
-      return std::make_unique<AMG<T>>(op, additional_data);
+      return std::make_unique<AMG<T>>(op, additional_data, reuse_hierarchy);
     else if (label == "BlockAMG")
-      return std::make_unique<BlockAMG<T>>(op, additional_data);
+      return std::make_unique<BlockAMG<T>>(op,
+                                           additional_data,
+                                           reuse_hierarchy);
 
     AssertThrow(
       false,
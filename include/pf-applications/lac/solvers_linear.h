@@ -1,15 +1,23 @@
 #pragma once
 
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/lac/solver_bicgstab.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/solver_gmres.h>
 #include <deal.II/lac/solver_idr.h>
+#include <deal.II/lac/vector.h>
 
 #include <pf-applications/base/timer.h>
 
 #include <pf-applications/lac/dynamic_block_vector.h>
 #include <pf-applications/lac/solvers_linear_parameters.h>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
 namespace LinearSolvers
 {
   using namespace dealii;
@@ -72,7 +80,14 @@ namespace LinearSolvers
 
       typename SolverGMRES<T>::AdditionalData additional_data;
 
-      if (data.orthogonalization_strategy == "classical gram schmidt")
+      if constexpr (std::is_same_v<T, BlockVectorType>)
+        if (data.orthogonalization_strategy == "fused classical gram schmidt")
+          return solve_fused(dst,
+                             src,
+                             additional_data.max_n_tmp_vectors - 2);
+
+      if (data.orthogonalization_strategy == "classical gram schmidt" ||
+          data.orthogonalization_strategy == "fused classical gram schmidt")
         additional_data.orthogonalization_strategy = SolverGMRES<
           T>::AdditionalData::OrthogonalizationStrategy::classical_gram_schmidt;
       else if (data.orthogonalization_strategy == "modified gram schmidt")
@@ -87,11 +102,944 @@ namespace LinearSolvers
       return solver_control.last_step();
     }
 
+    /* Restarted GMRES with left preconditioning, as SolverGMRES, whose
+     * classical Gram-Schmidt orthogonalization uses the multi-vector kernels
+     * of DynamicBlockVector: the projections onto the whole basis and the
+     * norm of the new vector need one pass and one reduction, the update of
+     * the new vector and its norm another one. A second orthogonalization
+     * step is only performed if the norm decreases too much.
+     */
+    template <typename T>
+    unsigned int
+    solve_fused(T &dst, const T &src, const unsigned int max_basis_size)
+    {
+      using Number = typename T::value_type;
+
+      // the basis vectors are allocated once they are needed, the reserved
+      // capacity keeps the pointers to them valid
+      std::vector<T> basis(1);
+      basis.reserve(max_basis_size + 1);
+      basis[0].reinit(dst);
+
+      T tmp;
+      tmp.reinit(dst);
+
+      FullMatrix<double>     H(max_basis_size + 1, max_basis_size);
+      dealii::Vector<double> gamma(max_basis_size + 1);
+      dealii::Vector<double> cs(max_basis_size);
+      dealii::Vector<double> sn(max_basis_size);
+
+      std::vector<const T *> basis_ptr;
+
+      unsigned int         step  = 0;
+      double               res   = 0.0;
+      SolverControl::State state = SolverControl::iterate;
+
+      while (state == SolverControl::iterate)
+        {
+          // residual of the preconditioned system
+          op.vmult(tmp, dst);
+          tmp.sadd(-1.0, 1.0, src);
+          preconditioner.vmult(basis[0], tmp);
+
+          res   = basis[0].l2_norm();
+          state = solver_control.check(step, res);
+
+          if (state != SolverControl::iterate)
+            break;
+
+          basis[0] *= 1.0 / res;
+
+          H        = 0.0;
+          gamma    = 0.0;
+          gamma[0] = res;
+
+          unsigned int dim = 0;
+
+          for (; dim < max_basis_size && state == SolverControl::iterate;
+               ++dim)
+            {
+              ++step;
+
+              if (basis.size() < dim + 2)
+                {
+                  basis.emplace_back();
+                  basis.back().reinit(dst);
+                }
+
+              auto &w = basis[dim + 1];
+
+              op.vmult(tmp, basis[dim]);
+              preconditioner.vmult(w, tmp);
+
+              // projections onto the basis and the norm of w at once
+              basis_ptr.clear();
+              for (unsigned int i = 0; i <= dim; ++i)
+                basis_ptr.push_back(&basis[i]);
+              basis_ptr.push_back(&w);
+
+              auto h = w.multi_dot(basis_ptr);
+
+              const double norm_w = std::sqrt(std::abs(h.back()));
+
+              basis_ptr.pop_back();
+              h.pop_back();
+
+              for (unsigned int i = 0; i <= dim; ++i)
+                H(i, dim) = h[i];
+
+              for (auto &h_i : h)
+                h_i = -h_i;
+
+              double norm = w.multi_add_and_l2_norm(h, basis_ptr);
+
+              // re-orthogonalize in case of severe cancellation
+              if (norm < 1. / std::sqrt(2.) * norm_w)
+                {
+                  h = w.multi_dot(basis_ptr);
+
+                  for (unsigned int i = 0; i <= dim; ++i)
+                    H(i, dim) += h[i];
+
+                  for (auto &h_i : h)
+                    h_i = -h_i;
+
+                  norm = w.multi_add_and_l2_norm(h, basis_ptr);
+                }
+
+              H(dim + 1, dim) = norm;
+
+              if (norm != 0.0)
+                w *= static_cast<Number>(1.0 / norm);
+
+              // apply previous Givens rotations to the new column
+              for (unsigned int i = 0; i < dim; ++i)
+                {
+                  const double h_0 = H(i, dim);
+                  const double h_1 = H(i + 1, dim);
+
+                  H(i, dim)     = cs[i] * h_0 + sn[i] * h_1;
+                  H(i + 1, dim) = -sn[i] * h_0 + cs[i] * h_1;
+                }
+
+              // compute and apply the new rotation
+              const double r =
+                std::sqrt(H(dim, dim) * H(dim, dim) + norm * norm);
+
+              cs[dim] = (r != 0.0) ? H(dim, dim) / r : 1.0;
+              sn[dim] = (r != 0.0) ? norm / r : 0.0;
+
+              H(dim, dim)     = r;
+              H(dim + 1, dim) = 0.0;
+
+              gamma[dim + 1] = -sn[dim] * gamma[dim];
+              gamma[dim]     = cs[dim] * gamma[dim];
+
+              res   = std::abs(gamma[dim + 1]);
+              state = solver_control.check(step, res);
+            }
+
+          // solve the upper triangular system and update the solution
+          std::vector<Number> y(dim);
+          for (int i = dim - 1; i >= 0; --i)
+            {
+              double sum = gamma[i];
+              for (unsigned int j = i + 1; j < dim; ++j)
+                sum -= H(i, j) * y[j];
+              y[i] = sum / H(i, i);
+            }
+
+          basis_ptr.clear();
+          for (unsigned int i = 0; i < dim; ++i)
+            basis_ptr.push_back(&basis[i]);
+
+          dst.multi_add(y, basis_ptr);
+        }
+
+      AssertThrow(state == SolverControl::success,
+                  SolverControl::NoConvergence(step, res));
+
+      return solver_control.last_step();
+    }
+
+    const Operator &op;
+    Preconditioner &preconditioner;
+    SolverControl & solver_control;
+    const GMRESData data;
+
+    mutable MyTimerOutput timer;
+  };
+
+
+
+  /* GCRO-DR (Parks et al., 2006): restarted GMRES with left preconditioning
+   * that augments the Krylov space with a deflation subspace U spanned by
+   * harmonic Ritz vectors of the preconditioned operator. The subspace is
+   * kept across solves: since the Jacobian changes between Newton steps and
+   * time steps, C = P^{-1} A U is recomputed and orthonormalized at the
+   * beginning of each solve. The subspace is discarded if the layout of the
+   * vectors has changed, i.e., after AMR or if the grain tracker has changed
+   * the number of blocks. Only block vectors are recycled.
+   */
+  template <typename Operator, typename Preconditioner>
+  class SolverGCRODRWrapper
+    : public LinearSolverBase<typename Operator::value_type>
+  {
+  public:
+    using Number          = typename Operator::value_type;
+    using VectorType      = typename Operator::vector_type;
+    using BlockVectorType = typename Operator::BlockVectorType;
+
+    SolverGCRODRWrapper(const Operator & op,
+                        Preconditioner & preconditioner,
+                        SolverControl &  solver_control,
+                        const GMRESData &data = GMRESData())
+      : op(op)
+      , preconditioner(preconditioner)
+      , solver_control(solver_control)
+      , data(data)
+    {}
+
+    unsigned int
+    solve(VectorType &dst, const VectorType &src) override
+    {
+      MyScope scope(timer, "gcrodr::solve");
+
+      SolverGMRES<VectorType> solver(solver_control);
+      solver.solve(op, dst, src, preconditioner);
+
+      return solver_control.last_step();
+    }
+
+    unsigned int
+    solve(BlockVectorType &dst, const BlockVectorType &src) override
+    {
+      MyScope scope(timer, "gcrodr::solve");
+
+      typename SolverGMRES<BlockVectorType>::AdditionalData additional_data;
+
+      const unsigned int max_basis_size =
+        additional_data.max_n_tmp_vectors - 2;
+      const unsigned int max_recycle_size =
+        std::min(data.recycling_dimension, max_basis_size - 1);
+
+      if (!U.empty() && !recycled_subspace_is_compatible(dst))
+        clear();
+
+      BlockVectorType r, tmp;
+      r.reinit(dst);
+      tmp.reinit(dst);
+
+      unsigned int         step  = 0;
+      double               res   = compute_residual(r, dst, src, tmp);
+      SolverControl::State state = solver_control.check(step, res);
+
+      // the operator has changed since the last solve
+      if (state == SolverControl::iterate && !U.empty())
+        {
+          MyScope scope(timer, "gcrodr::setup_recycled_subspace");
+
+          for (unsigned int i = 0; i < U.size(); ++i)
+            apply(C[i], U[i], tmp);
+
+          orthonormalize_recycled_subspace();
+        }
+
+      std::vector<BlockVectorType> V;
+
+      while (state == SolverControl::iterate)
+        {
+          const unsigned int n_c       = C.size();
+          const unsigned int n_arnoldi = max_basis_size - n_c;
+
+          // minimize the residual over span(U), i.e., make it orthogonal
+          // to span(C)
+          if (n_c > 0)
+            {
+              auto c = r.multi_dot(pointers(C));
+              dst.multi_add(c, pointers(U));
+
+              for (auto &c_i : c)
+                c_i = -c_i;
+
+              res = r.multi_add_and_l2_norm(c, pointers(C));
+
+              if (res == 0.0)
+                {
+                  state = SolverControl::success;
+                  break;
+                }
+            }
+
+          for (unsigned int i = V.size(); i < n_arnoldi + 1; ++i)
+            {
+              V.emplace_back();
+              V.back().reinit(dst);
+            }
+
+          V[0].equ(1.0 / res, r);
+
+          // Arnoldi process for (I - C C^T) P^{-1} A, H is kept unrotated
+          // for the update of the recycled subspace
+          FullMatrix<double>     H(n_arnoldi + 1, n_arnoldi);
+          FullMatrix<double>     R(n_arnoldi + 1, n_arnoldi);
+          FullMatrix<double>     B(n_c, n_arnoldi);
+          dealii::Vector<double> gamma(n_arnoldi + 1);
+          dealii::Vector<double> cs(n_arnoldi);
+          dealii::Vector<double> sn(n_arnoldi);
+
+          gamma[0] = res;
+
+          unsigned int dim = 0;
+
+          for (; dim < n_arnoldi && state == SolverControl::iterate; ++dim)
+            {
+              ++step;
+
+              auto &w = V[dim + 1];
+
+              apply(w, V[dim], tmp);
+
+              // classical Gram-Schmidt against C and the Arnoldi basis
+              auto basis_ptr = pointers(C);
+              for (unsigned int i = 0; i <= dim; ++i)
+                basis_ptr.push_back(&V[i]);
+              basis_ptr.push_back(&w);
+
+              auto h = w.multi_dot(basis_ptr);
+
+              const double norm_w = std::sqrt(std::abs(h.back()));
+
+              basis_ptr.pop_back();
+              h.pop_back();
+
+              for (auto &h_i : h)
+                h_i = -h_i;
+
+              double norm = w.multi_add_and_l2_norm(h, basis_ptr);
+
+              // re-orthogonalize in case of severe cancellation
+              if (norm < 1. / std::sqrt(2.) * norm_w)
+                {
+                  auto h_2 = w.multi_dot(basis_ptr);
+
+                  for (unsigned int i = 0; i < h.size(); ++i)
+                    {
+                      h[i] -= h_2[i];
+                      h_2[i] = -h_2[i];
+                    }
+
+                  norm = w.multi_add_and_l2_norm(h_2, basis_ptr);
+                }
+
+              for (unsigned int i = 0; i < n_c; ++i)
+                B(i, dim) = -h[i];
+
+              for (unsigned int i = 0; i <= dim; ++i)
+                H(i, dim) = R(i, dim) = -h[n_c + i];
+
+              H(dim + 1, dim) = norm;
+
+              if (norm != 0.0)
+                w *= static_cast<Number>(1.0 / norm);
+
+              // apply previous Givens rotations to the new column
+              for (unsigned int i = 0; i < dim; ++i)
+                {
+                  const double h_0 = R(i, dim);
+                  const double h_1 = R(i + 1, dim);
+
+                  R(i, dim)     = cs[i] * h_0 + sn[i] * h_1;
+                  R(i + 1, dim) = -sn[i] * h_0 + cs[i] * h_1;
+                }
+
+              // compute and apply the new rotation
+              const double r_dim =
+                std::sqrt(R(dim, dim) * R(dim, dim) + norm * norm);
+
+              cs[dim] = (r_dim != 0.0) ? R(dim, dim) / r_dim : 1.0;
+              sn[dim] = (r_dim != 0.0) ? norm / r_dim : 0.0;
+
+              R(dim, dim) = r_dim;
+
+              gamma[dim + 1] = -sn[dim] * gamma[dim];
+              gamma[dim]     = cs[dim] * gamma[dim];
+
+              res   = std::abs(gamma[dim + 1]);
+              state = solver_control.check(step, res);
+            }
+
+          // solve the upper triangular system
+          std::vector<double> y(dim);
+          for (int i = dim - 1; i >= 0; --i)
+            {
+              double sum = gamma[i];
+              for (unsigned int j = i + 1; j < dim; ++j)
+                sum -= R(i, j) * y[j];
+              y[i] = sum / R(i, i);
+            }
+
+          // update the solution: x += V y - U B y
+          std::vector<Number> coefficients(n_c + dim, 0.0);
+          for (unsigned int i = 0; i < n_c; ++i)
+            for (unsigned int j = 0; j < dim; ++j)
+              coefficients[i] -= B(i, j) * y[j];
+          for (unsigned int j = 0; j < dim; ++j)
+            coefficients[n_c + j] = y[j];
+
+          auto basis_ptr = pointers(U);
+          for (unsigned int j = 0; j < dim; ++j)
+            basis_ptr.push_back(&V[j]);
+
+          dst.multi_add(coefficients, basis_ptr);
+
+          if (max_recycle_size > 0)
+            update_recycled_subspace(H, B, dim, max_recycle_size, V);
+
+          res   = compute_residual(r, dst, src, tmp);
+          state = solver_control.check(step, res);
+        }
+
+      AssertThrow(state == SolverControl::success,
+                  SolverControl::NoConvergence(step, res));
+
+      return solver_control.last_step();
+    }
+
+    unsigned int
+    n_recycled_vectors() const
+    {
+      return U.size();
+    }
+
+    void
+    clear()
+    {
+      U.clear();
+      C.clear();
+    }
+
+  private:
+    void
+    apply(BlockVectorType &      dst,
+          const BlockVectorType &src,
+          BlockVectorType &      tmp) const
+    {
+      op.vmult(tmp, src);
+      preconditioner.vmult(dst, tmp);
+    }
+
+    double
+    compute_residual(BlockVectorType &      r,
+                     const BlockVectorType &dst,
+                     const BlockVectorType &src,
+                     BlockVectorType &      tmp) const
+    {
+      op.vmult(tmp, dst);
+      tmp.sadd(-1.0, 1.0, src);
+      preconditioner.vmult(r, tmp);
+
+      return r.l2_norm();
+    }
+
+    static std::vector<const BlockVectorType *>
+    pointers(const std::vector<BlockVectorType> &vectors)
+    {
+      std::vector<const BlockVectorType *> result;
+      for (const auto &v : vectors)
+        result.push_back(&v);
+      return result;
+    }
+
+    bool
+    recycled_subspace_is_compatible(const BlockVectorType &vec) const
+    {
+      bool compatible = U[0].n_blocks() == vec.n_blocks();
+
+      for (unsigned int b = 0; compatible && b < vec.n_blocks(); ++b)
+        compatible = U[0].block(b).get_partitioner().get() ==
+                     vec.block(b).get_partitioner().get();
+
+      // the decision has to be the same on all processes
+      return Utilities::MPI::min(static_cast<unsigned int>(compatible),
+                                 vec.block(0).get_mpi_communicator()) == 1;
+    }
+
+    /* Orthonormalize C and apply the same transformation to U, so that
+     * C = P^{-1} A U still holds (C = Q R, U := U R^{-1}). Vectors that have
+     * become linearly dependent are dropped.
+     */
+    void
+    orthonormalize_recycled_subspace()
+    {
+      for (unsigned int i = 0; i < C.size(); ++i)
+        {
+          const double norm_0 = C[i].l2_norm();
+
+          // classical Gram-Schmidt, performed twice
+          if (i > 0)
+            for (unsigned int pass = 0; pass < 2; ++pass)
+              {
+                std::vector<const BlockVectorType *> c_ptr, u_ptr;
+                for (unsigned int j = 0; j < i; ++j)
+                  {
+                    c_ptr.push_back(&C[j]);
+                    u_ptr.push_back(&U[j]);
+                  }
+
+                auto h = C[i].multi_dot(c_ptr);
+                for (auto &h_j : h)
+                  h_j = -h_j;
+
+                C[i].multi_add(h, c_ptr);
+                U[i].multi_add(h, u_ptr);
+              }
+
+          const double norm = C[i].l2_norm();
+
+          if (norm <= 1e-12 * norm_0 || norm == 0.0)
+            {
+              C.resize(i);
+              U.resize(i);
+              break;
+            }
+
+          C[i] *= static_cast<Number>(1.0 / norm);
+          U[i] *= static_cast<Number>(1.0 / norm);
+        }
+    }
+
+    /* Replace the recycled subspace by the harmonic Ritz vectors of the
+     * current cycle belonging to the harmonic Ritz values of smallest
+     * magnitude. With W = [U, V_0, ..., V_{dim-1}] and
+     * V_hat = [C, V_0, ..., V_dim], P^{-1} A W = V_hat G holds and the
+     * harmonic Ritz vectors W z are the solutions of the generalized
+     * eigenvalue problem G^T G z = theta G^T V_hat^T W z.
+     */
+    void
+    update_recycled_subspace(const FullMatrix<double> &          H,
+                             const FullMatrix<double> &          B,
+                             const unsigned int                  dim,
+                             const unsigned int                  k,
+                             const std::vector<BlockVectorType> &V)
+    {
+      MyScope scope(timer, "gcrodr::update_recycled_subspace");
+
+      const unsigned int n_c = C.size();
+      const unsigned int n   = n_c + dim;
+
+      if (dim == 0)
+        return;
+
+      auto w_ptr = pointers(U);
+      for (unsigned int j = 0; j < dim; ++j)
+        w_ptr.push_back(&V[j]);
+
+      auto v_hat_ptr = pointers(C);
+      for (unsigned int j = 0; j <= dim; ++j)
+        v_hat_ptr.push_back(&V[j]);
+
+      FullMatrix<double> G(n + 1, n);
+      for (unsigned int i = 0; i < n_c; ++i)
+        {
+          G(i, i) = 1.0;
+          for (unsigned int j = 0; j < dim; ++j)
+            G(i, n_c + j) = B(i, j);
+        }
+      for (unsigned int i = 0; i <= dim; ++i)
+        for (unsigned int j = 0; j < dim; ++j)
+          G(n_c + i, n_c + j) = H(i, j);
+
+      // V_hat^T W: the Arnoldi vectors are orthonormal and orthogonal to C
+      FullMatrix<double> VW(n + 1, n);
+      for (unsigned int j = 0; j < n_c; ++j)
+        {
+          const auto p = U[j].multi_dot(v_hat_ptr);
+          for (unsigned int i = 0; i <= n; ++i)
+            VW(i, j) = p[i];
+        }
+      for (unsigned int j = 0; j < dim; ++j)
+        VW(n_c + j, n_c + j) = 1.0;
+
+      // G^T G is SPD, which allows to solve the standard eigenvalue problem
+      // (G^T G)^{-1} G^T V_hat^T W z = theta^{-1} z instead
+      FullMatrix<double> GtG(n, n), GtG_inv(n, n), GtVW(n, n), M(n, n);
+      G.Tmmult(GtG, G);
+      G.Tmmult(GtVW, VW);
+      GtG_inv.invert(GtG);
+      GtG_inv.mmult(M, GtVW);
+
+      LAPACKFullMatrix<double> M_lapack(n, n);
+      M_lapack = M;
+      M_lapack.compute_eigenvalues(true, false);
+
+      const auto eigenvectors = M_lapack.get_right_eigenvectors();
+
+      std::vector<unsigned int> indices(n);
+      std::iota(indices.begin(), indices.end(), 0);
+      std::sort(indices.begin(),
+                indices.end(),
+                [&](const auto i, const auto j) {
+                  return std::abs(M_lapack.eigenvalue(i)) >
+                         std::abs(M_lapack.eigenvalue(j));
+                });
+
+      // real basis of the selected eigenvectors (complex conjugate pairs
+      // contribute their real and imaginary part)
+      FullMatrix<double> P(n, k + 1);
+      unsigned int       n_p = 0;
+
+      for (const auto i : indices)
+        {
+          if (n_p >= std::min(k, n))
+            break;
+
+          const auto lambda = M_lapack.eigenvalue(i);
+
+          if (lambda.imag() < 0.0)
+            continue;
+
+          for (unsigned int j = 0; j < n; ++j)
+            P(j, n_p) = eigenvectors(j, i).real();
+          ++n_p;
+
+          if (lambda.imag() > 0.0 && n_p < n)
+            {
+              for (unsigned int j = 0; j < n; ++j)
+                P(j, n_p) = eigenvectors(j, i).imag();
+              ++n_p;
+            }
+        }
+
+      if (n_p == 0)
+        return;
+
+      // QR factorization G P = Q R with modified Gram-Schmidt
+      FullMatrix<double> Q(n + 1, n_p);
+      for (unsigned int i = 0; i <= n; ++i)
+        for (unsigned int j = 0; j < n_p; ++j)
+          for (unsigned int l = 0; l < n; ++l)
+            Q(i, j) += G(i, l) * P(l, j);
+
+      FullMatrix<double> R(n_p, n_p);
+      for (unsigned int j = 0; j < n_p; ++j)
+        {
+          double norm_0 = 0.0;
+          for (unsigned int i = 0; i <= n; ++i)
+            norm_0 += Q(i, j) * Q(i, j);
+
+          for (unsigned int l = 0; l < j; ++l)
+            {
+              for (unsigned int i = 0; i <= n; ++i)
+                R(l, j) += Q(i, l) * Q(i, j);
+              for (unsigned int i = 0; i <= n; ++i)
+                Q(i, j) -= R(l, j) * Q(i, l);
+            }
+
+          double norm = 0.0;
+          for (unsigned int i = 0; i <= n; ++i)
+            norm += Q(i, j) * Q(i, j);
+
+          // keep the old subspace if the new one is degenerate
+          if (norm <= 1e-24 * norm_0 || norm == 0.0)
+            return;
+
+          R(j, j) = std::sqrt(norm);
+          for (unsigned int i = 0; i <= n; ++i)
+            Q(i, j) /= R(j, j);
+        }
+
+      // U := W P R^{-1}, C := V_hat Q
+      FullMatrix<double> PR(n, n_p);
+      for (unsigned int j = 0; j < n_p; ++j)
+        for (unsigned int i = 0; i < n; ++i)
+          {
+            double sum = P(i, j);
+            for (unsigned int l = 0; l < j; ++l)
+              sum -= PR(i, l) * R(l, j);
+            PR(i, j) = sum / R(j, j);
+          }
+
+      std::vector<BlockVectorType> U_new(n_p), C_new(n_p);
+
+      for (unsigned int j = 0; j < n_p; ++j)
+        {
+          std::vector<Number> u_coefficients(n), c_coefficients(n + 1);
+          for (unsigned int i = 0; i < n; ++i)
+            u_coefficients[i] = PR(i, j);
+          for (unsigned int i = 0; i <= n; ++i)
+            c_coefficients[i] = Q(i, j);
+
+          U_new[j].reinit(V[0]);
+          U_new[j].multi_add(u_coefficients, w_ptr);
+
+          C_new[j].reinit(V[0]);
+          C_new[j].multi_add(c_coefficients, v_hat_ptr);
+        }
+
+      U.swap(U_new);
+      C.swap(C_new);
+    }
+
     const Operator &op;
     Preconditioner &preconditioner;
     SolverControl & solver_control;
     const GMRESData data;
 
+    // recycled subspace with C = P^{-1} A U and C^T C = I
+    std::vector<BlockVectorType> U;
+    std::vector<BlockVectorType> C;
+
+    mutable MyTimerOutput timer;
+  };
+
+
+
+  /* Pipelined GMRES (p1-GMRES, Ghysels et al., 2013) with left
+   * preconditioning. Besides the orthonormal basis V, the vectors
+   * Z = P^{-1} A V are updated by a recurrence, so that the application of
+   * the operator and the preconditioner to the newest vector can be
+   * overlapped with the (single and non-blocking) global reduction of the
+   * classical Gram-Schmidt step. The norm of the new basis vector is
+   * obtained from its projections; if it cannot be computed accurately
+   * anymore, the cycle is restarted. Only block vectors are pipelined,
+   * plain vectors are solved with SolverGMRES.
+   */
+  template <typename Operator, typename Preconditioner>
+  class SolverPipelinedGMRESWrapper
+    : public LinearSolverBase<typename Operator::value_type>
+  {
+  public:
+    using Number          = typename Operator::value_type;
+    using VectorType      = typename Operator::vector_type;
+    using BlockVectorType = typename Operator::BlockVectorType;
+
+    SolverPipelinedGMRESWrapper(const Operator &op,
+                                Preconditioner &preconditioner,
+                                SolverControl & solver_control)
+      : op(op)
+      , preconditioner(preconditioner)
+      , solver_control(solver_control)
+    {}
+
+    unsigned int
+    solve(VectorType &dst, const VectorType &src) override
+    {
+      MyScope scope(timer, "pgmres::solve");
+
+      SolverGMRES<VectorType> solver(solver_control);
+      solver.solve(op, dst, src, preconditioner);
+
+      return solver_control.last_step();
+    }
+
+    unsigned int
+    solve(BlockVectorType &dst, const BlockVectorType &src) override
+    {
+      MyScope scope(timer, "pgmres::solve");
+
+      typename SolverGMRES<BlockVectorType>::AdditionalData additional_data;
+
+      const unsigned int max_basis_size =
+        additional_data.max_n_tmp_vectors - 2;
+
+      const MPI_Comm comm = dst.block(0).get_mpi_communicator();
+
+      // the basis vectors are allocated once they are needed, the reserved
+      // capacity keeps the pointers to them valid
+      std::vector<BlockVectorType> V(1);
+      std::vector<BlockVectorType> Z(1);
+      V.reserve(max_basis_size);
+      Z.reserve(max_basis_size);
+      V[0].reinit(dst);
+      Z[0].reinit(dst);
+
+      BlockVectorType q, tmp;
+      q.reinit(dst);
+      tmp.reinit(dst);
+
+      FullMatrix<double>     H(max_basis_size + 1, max_basis_size);
+      dealii::Vector<double> gamma(max_basis_size + 1);
+      dealii::Vector<double> cs(max_basis_size);
+      dealii::Vector<double> sn(max_basis_size);
+
+      std::vector<const BlockVectorType *> v_ptr, z_ptr;
+
+      unsigned int         step  = 0;
+      double               res   = 0.0;
+      SolverControl::State state = SolverControl::iterate;
+
+      while (state == SolverControl::iterate)
+        {
+          // residual of the preconditioned system
+          op.vmult(tmp, dst);
+          tmp.sadd(-1.0, 1.0, src);
+          preconditioner.vmult(V[0], tmp);
+
+          res   = V[0].l2_norm();
+          state = solver_control.check(step, res);
+
+          if (state != SolverControl::iterate)
+            break;
+
+          V[0] *= static_cast<Number>(1.0 / res);
+          apply(Z[0], V[0], tmp);
+
+          H        = 0.0;
+          gamma    = 0.0;
+          gamma[0] = res;
+
+          unsigned int dim       = 0;
+          bool         breakdown = false;
+
+          while (dim < max_basis_size && state == SolverControl::iterate &&
+                 breakdown == false)
+            {
+              ++step;
+
+              // start the reduction of the projections of Z[dim] onto the
+              // basis and of its norm ...
+              v_ptr.clear();
+              for (unsigned int i = 0; i <= dim; ++i)
+                v_ptr.push_back(&V[i]);
+              v_ptr.push_back(&Z[dim]);
+
+              auto h = Z[dim].multi_dot_local(v_ptr);
+
+              MPI_Request request;
+              int         ierr = MPI_Iallreduce(
+                MPI_IN_PLACE,
+                h.data(),
+                h.size(),
+                Utilities::MPI::mpi_type_id_for_type<Number>,
+                MPI_SUM,
+                comm,
+                &request);
+              AssertThrowMPI(ierr);
+
+              // ... and overlap it with the application of the operator
+              apply(q, Z[dim], tmp);
+
+              {
+                MyScope scope(timer, "pgmres::wait");
+                ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+                AssertThrowMPI(ierr);
+              }
+
+              const double norm_z_sqr = h.back();
+
+              v_ptr.pop_back();
+              h.pop_back();
+
+              double norm_sqr = norm_z_sqr;
+              for (const auto h_i : h)
+                norm_sqr -= static_cast<double>(h_i) * h_i;
+
+              breakdown =
+                norm_sqr <=
+                100 * std::numeric_limits<Number>::epsilon() * norm_z_sqr;
+
+              const double norm = breakdown ? 0.0 : std::sqrt(norm_sqr);
+
+              for (unsigned int i = 0; i <= dim; ++i)
+                H(i, dim) = h[i];
+
+              // apply previous Givens rotations to the new column
+              for (unsigned int i = 0; i < dim; ++i)
+                {
+                  const double h_0 = H(i, dim);
+                  const double h_1 = H(i + 1, dim);
+
+                  H(i, dim)     = cs[i] * h_0 + sn[i] * h_1;
+                  H(i + 1, dim) = -sn[i] * h_0 + cs[i] * h_1;
+                }
+
+              // compute and apply the new rotation
+              const double r =
+                std::sqrt(H(dim, dim) * H(dim, dim) + norm * norm);
+
+              cs[dim] = (r != 0.0) ? H(dim, dim) / r : 1.0;
+              sn[dim] = (r != 0.0) ? norm / r : 0.0;
+
+              H(dim, dim) = r;
+
+              gamma[dim + 1] = -sn[dim] * gamma[dim];
+              gamma[dim]     = cs[dim] * gamma[dim];
+
+              res = std::abs(gamma[dim + 1]);
+
+              // the estimate vanishes at a breakdown, hence, convergence is
+              // only checked with the explicit residual after the restart
+              if (breakdown == false)
+                state = solver_control.check(step, res);
+
+              ++dim;
+
+              // next basis vector V[dim] = (Z[dim-1] - V h) / norm and
+              // Z[dim] = P^{-1} A V[dim] = (q - Z h) / norm
+              if (state == SolverControl::iterate && breakdown == false &&
+                  dim < max_basis_size)
+                {
+                  z_ptr.clear();
+                  for (unsigned int i = 0; i < dim; ++i)
+                    z_ptr.push_back(&Z[i]);
+
+                  for (auto &h_i : h)
+                    h_i = -h_i / norm;
+
+                  if (V.size() == dim)
+                    {
+                      V.emplace_back();
+                      V.back().reinit(dst);
+                      Z.emplace_back();
+                      Z.back().reinit(dst);
+                    }
+
+                  V[dim].equ(1.0 / norm, Z[dim - 1]);
+                  V[dim].multi_add(h, v_ptr);
+
+                  Z[dim].equ(1.0 / norm, q);
+                  Z[dim].multi_add(h, z_ptr);
+                }
+            }
+
+          // solve the upper triangular system and update the solution
+          std::vector<Number> y(dim);
+          for (int i = dim - 1; i >= 0; --i)
+            {
+              double sum = gamma[i];
+              for (unsigned int j = i + 1; j < dim; ++j)
+                sum -= H(i, j) * y[j];
+              y[i] = sum / H(i, i);
+            }
+
+          v_ptr.clear();
+          for (unsigned int i = 0; i < dim; ++i)
+            v_ptr.push_back(&V[i]);
+
+          dst.multi_add(y, v_ptr);
+        }
+
+      AssertThrow(state == SolverControl::success,
+                  SolverControl::NoConvergence(step, res));
+
+      return solver_control.last_step();
+    }
+
+  private:
+    void
+    apply(BlockVectorType &      dst,
+          const BlockVectorType &src,
+          BlockVectorType &      tmp) const
+    {
+      op.vmult(tmp, src);
+      preconditioner.vmult(dst, tmp);
+    }
+
+    const Operator &op;
+    Preconditioner &preconditioner;
+    SolverControl & solver_control;
+
     mutable MyTimerOutput timer;
   };
 
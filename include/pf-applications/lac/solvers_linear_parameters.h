@@ -4,6 +4,7 @@ namespace LinearSolvers
 {
   struct GMRESData
   {
-    std::string orthogonalization_strategy = "classical gram schmidt";
+    std::string  orthogonalization_strategy = "classical gram schmidt";
+    unsigned int recycling_dimension        = 10;
   };
 } // namespace LinearSolvers
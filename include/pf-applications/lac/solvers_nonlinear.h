@@ -5,6 +5,8 @@
 
 #include <pf-applications/base/timer.h>
 
+#include <chrono>
+
 #include <deal.II/trilinos/nox.h>
 
 #include "solvers_nonlinear_snes.h"
@@ -31,9 +33,11 @@ namespace NonLinearSolvers
     void
     clear()
     {
-      newton_iterations    = 0;
-      linear_iterations    = 0;
-      residual_evaluations = 0;
+      newton_iterations       = 0;
+      linear_iterations       = 0;
+      residual_evaluations    = 0;
+      preconditioner_updates  = 0;
+      forcing_terms.clear();
     }
 
     unsigned int
@@ -54,6 +58,14 @@ namespace NonLinearSolvers
       return residual_evaluations;
     }
 
+    /* Adaptive forcing terms of the Newton iterations, each together with
+     * the number of linear iterations needed to reach it. */
+    const std::vector<std::pair<double, unsigned int>> &
+    get_forcing_terms() const
+    {
+      return forcing_terms;
+    }
+
     void
     increment_newton_iterations(const unsigned int num)
     {
@@ -72,6 +84,24 @@ namespace NonLinearSolvers
       residual_evaluations += num;
     }
 
+    void
+    register_forcing_term(const double eta, const unsigned int n_iterations)
+    {
+      forcing_terms.emplace_back(eta, n_iterations);
+    }
+
+    unsigned int
+    n_preconditioner_updates() const
+    {
+      return preconditioner_updates;
+    }
+
+    void
+    increment_preconditioner_updates(const unsigned int num)
+    {
+      preconditioner_updates += num;
+    }
+
     template <typename VectorType>
     SolverControl::State
     check(const unsigned int step,
@@ -136,6 +166,10 @@ namespace NonLinearSolvers
     unsigned int newton_iterations    = 0;
     unsigned int linear_iterations    = 0;
     unsigned int residual_evaluations = 0;
+
+    unsigned int preconditioner_updates = 0;
+
+    std::vector<std::pair<double, unsigned int>> forcing_terms;
   };
 
 
@@ -159,6 +193,20 @@ namespace NonLinearSolvers
     const unsigned int threshold_linear_iter;
     const bool         reuse_preconditioner;
     const bool         use_damping;
+
+    // Relative tolerance of the linear solver: either constant
+    // (linear_rel_tol) or chosen by one of the Eisenstat-Walker strategies
+    // (EisenstatWalker1, EisenstatWalker2)
+    std::string forcing_term       = "Constant";
+    double      linear_rel_tol     = 1e-2;
+    double      forcing_term_max   = 0.9;
+    double      forcing_term_gamma = 0.9;
+    double      forcing_term_alpha = 2.0;
+
+    // Update of the preconditioner: either controlled by the thresholds
+    // above (Threshold) or by comparing its setup time with the time lost
+    // due to the increasing number of linear iterations (CostModel)
+    std::string preconditioner_update_policy = "Threshold";
   };
 
 
@@ -207,6 +255,8 @@ namespace NonLinearSolvers
     std::function<void(const VectorType &)> setup_preconditioner         = {};
     std::function<unsigned int(const VectorType &, VectorType &)>
       solve_with_jacobian = {};
+    std::function<void(const double)> set_linear_relative_tolerance = {};
+    std::function<void(const VectorType &, VectorType &)> apply_jacobian = {};
     std::function<SolverControl::State(const unsigned int,
                                        const double,
                                        const VectorType &,
@@ -247,6 +297,27 @@ namespace NonLinearSolvers
       double   norm_r = vec_residual.l2_norm();
       unsigned it     = 0;
 
+      // adaptive forcing terms
+      const bool use_forcing_term = solver_data.forcing_term != "Constant";
+
+      AssertThrow(use_forcing_term == false ||
+                    this->set_linear_relative_tolerance,
+                  ExcMessage("Adaptive forcing terms require "
+                             "set_linear_relative_tolerance to be set."));
+
+      AssertThrow(solver_data.forcing_term != "EisenstatWalker1" ||
+                    this->apply_jacobian,
+                  ExcMessage("EisenstatWalker1 requires "
+                             "apply_jacobian to be set."));
+
+      const double norm_r_0      = norm_r;
+      double       norm_r_old    = norm_r;
+      double       norm_r_linear = 0.0;
+      double       eta           = solver_data.forcing_term_max;
+
+      const bool use_cost_model =
+        solver_data.preconditioner_update_policy == "CostModel";
+
       auto status = check(it, norm_r, dst, vec_residual);
 
       while (status == SolverControl::iterate)
@@ -267,13 +338,77 @@ namespace NonLinearSolvers
 
           this->setup_jacobian(dst);
 
+          const bool update_preconditioner =
+            use_cost_model ? cost_model.update_is_worthwhile() :
+                             threshold_exceeded;
+
           if (this->setup_preconditioner && solver_data.do_update &&
-              threshold_exceeded)
-            this->setup_preconditioner(dst);
+              update_preconditioner)
+            {
+              const auto start = std::chrono::steady_clock::now();
+
+              this->setup_preconditioner(dst);
+
+              if (use_cost_model)
+                {
+                  const double time =
+                    std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+
+                  cost_model.register_setup(
+                    Utilities::MPI::max(time, dst.get_mpi_communicator()));
+                }
+
+              statistics.increment_preconditioner_updates(1);
+            }
+
+          if (use_forcing_term)
+            {
+              if (it > 0)
+                eta = compute_forcing_term(eta,
+                                           norm_r,
+                                           norm_r_old,
+                                           norm_r_linear,
+                                           norm_r_0);
+
+              this->set_linear_relative_tolerance(eta);
+            }
+
+          const auto start = std::chrono::steady_clock::now();
 
           history_linear_iterations_last =
             this->solve_with_jacobian(vec_residual, increment);
 
+          if (use_cost_model)
+            {
+              const double time = std::chrono::duration<double>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count();
+
+              cost_model.register_solve(
+                history_linear_iterations_last,
+                Utilities::MPI::max(time, dst.get_mpi_communicator()));
+            }
+
+          if (use_forcing_term)
+            {
+              // residual of the linearized problem F(x_k) + J s_k, which
+              // is not reported by a (preconditioned) linear solver; note
+              // that vec_residual contains -F(x_k)
+              if (solver_data.forcing_term == "EisenstatWalker1")
+                {
+                  this->apply_jacobian(increment, tmp);
+                  tmp.add(-1.0, vec_residual);
+                  norm_r_linear = tmp.l2_norm();
+                }
+
+              norm_r_old = norm_r;
+
+              statistics.register_forcing_term(eta,
+                                               history_linear_iterations_last);
+            }
+
           if (this->solver_data.use_damping)
             {
               // damped Newton scheme
@@ -344,9 +479,116 @@ namespace NonLinearSolvers
     {
       history_linear_iterations_last = 0;
       history_newton_iterations      = 0;
+
+      cost_model.clear();
     }
 
   private:
+    /* Cost model for the update of the preconditioner. The time lost due to
+     * the growth of the number of linear iterations since the last update
+     * (compared to the first linear solve after the update) is accumulated
+     * and the preconditioner is rebuilt as soon as it exceeds the setup
+     * time. For linearly growing iteration numbers, this minimizes the
+     * average time per linear solve. All times are the maximum over all
+     * processes so that the decision is the same everywhere.
+     */
+    struct PreconditionerCostModel
+    {
+      bool
+      update_is_worthwhile() const
+      {
+        return is_initialized == false || time_lost >= setup_time;
+      }
+
+      void
+      register_setup(const double time)
+      {
+        is_initialized          = true;
+        setup_time              = time;
+        time_lost               = 0.0;
+        first_solve_after_setup = true;
+      }
+
+      void
+      register_solve(const unsigned int n_iterations, const double time)
+      {
+        if (n_iterations > 0)
+          time_per_iteration = time / n_iterations;
+
+        if (first_solve_after_setup)
+          {
+            n_iterations_after_setup = n_iterations;
+            first_solve_after_setup  = false;
+          }
+        else
+          {
+            time_lost += time_per_iteration *
+                         (static_cast<double>(n_iterations) -
+                          static_cast<double>(n_iterations_after_setup));
+            time_lost = std::max(time_lost, 0.0);
+          }
+      }
+
+      void
+      clear()
+      {
+        *this = PreconditionerCostModel();
+      }
+
+      bool         is_initialized           = false;
+      bool         first_solve_after_setup  = true;
+      double       setup_time               = 0.0;
+      double       time_per_iteration       = 0.0;
+      double       time_lost                = 0.0;
+      unsigned int n_iterations_after_setup = 0;
+    };
+
+
+    /* Eisenstat-Walker forcing terms (choice 1 and 2) including their
+     * safeguards and a lower bound avoiding to oversolve the last linear
+     * system.
+     */
+    double
+    compute_forcing_term(const double eta_old,
+                         const double norm_r,
+                         const double norm_r_old,
+                         const double norm_r_linear,
+                         const double norm_r_0) const
+    {
+      double eta           = 0.0;
+      double eta_safeguard = 0.0;
+
+      if (solver_data.forcing_term == "EisenstatWalker1")
+        {
+          const double alpha = 0.5 * (1.0 + std::sqrt(5.0));
+
+          eta           = std::abs(norm_r - norm_r_linear) / norm_r_old;
+          eta_safeguard = std::pow(eta_old, alpha);
+        }
+      else if (solver_data.forcing_term == "EisenstatWalker2")
+        {
+          const double gamma = solver_data.forcing_term_gamma;
+          const double alpha = solver_data.forcing_term_alpha;
+
+          eta           = gamma * std::pow(norm_r / norm_r_old, alpha);
+          eta_safeguard = gamma * std::pow(eta_old, alpha);
+        }
+      else
+        AssertThrow(false, ExcNotImplemented());
+
+      if (eta_safeguard > 0.1)
+        eta = std::max(eta, eta_safeguard);
+
+      eta = std::min(eta, solver_data.forcing_term_max);
+
+      const double nonlinear_tol =
+        std::max(statistics.get_abs_tol(), statistics.get_rel_tol() * norm_r_0);
+
+      eta = std::max(eta, 0.5 * nonlinear_tol / norm_r);
+
+      return std::min(eta, solver_data.forcing_term_max);
+    }
+
     SolverControl::State
     check(const unsigned int step,
           const double       check_value,
@@ -374,6 +616,8 @@ namespace NonLinearSolvers
 
     mutable unsigned int history_linear_iterations_last = 0;
     mutable unsigned int history_newton_iterations      = 0;
+
+    mutable PreconditionerCostModel cost_model;
   };
 
   template <typename VectorType, typename SolverType>
@@ -549,6 +793,68 @@ namespace NonLinearSolvers
     const OperatorType &op;
   };
 
+  template <typename Number, typename OperatorType>
+  class JacobianMixedPrecision : public JacobianBase<Number>
+  {
+  public:
+    using value_type      = typename JacobianBase<Number>::value_type;
+    using vector_type     = typename JacobianBase<Number>::vector_type;
+    using VectorType      = typename JacobianBase<Number>::VectorType;
+    using BlockVectorType = typename JacobianBase<Number>::BlockVectorType;
+
+    using InnerNumber = typename OperatorType::value_type;
+    using InnerBlockVectorType =
+      LinearAlgebra::distributed::DynamicBlockVector<InnerNumber>;
+
+    JacobianMixedPrecision(const OperatorType &op)
+      : op(op)
+    {}
+
+    void
+    vmult(VectorType &, const VectorType &) const override
+    {
+      AssertThrow(false, ExcNotImplemented());
+    }
+
+    void
+    vmult(BlockVectorType &dst, const BlockVectorType &src) const override
+    {
+      MyScope scope(timer, "jacobian_mixed_precision::vmult");
+
+      if (src_inner.n_blocks() != src.n_blocks())
+        {
+          op.initialize_dof_vector(src_inner);
+          op.initialize_dof_vector(dst_inner);
+        }
+
+      src_inner.copy_locally_owned_data_from(src);
+      op.vmult(dst_inner, src_inner);
+      dst.copy_locally_owned_data_from(dst_inner);
+    }
+
+    void
+    reinit(const VectorType &) override
+    {
+      AssertThrow(false, ExcNotImplemented());
+    }
+
+    void
+    reinit(const BlockVectorType &) override
+    {
+      // the inner operator is set up elsewhere, vectors might have changed
+      src_inner.reinit(0);
+      dst_inner.reinit(0);
+    }
+
+  private:
+    const OperatorType &op;
+
+    mutable InnerBlockVectorType src_inner;
+    mutable InnerBlockVectorType dst_inner;
+
+    mutable MyTimerOutput timer;
+  };
+
   template <typename Number, typename OperatorType>
   class JacobianFree : public JacobianBase<Number>
   {
@@ -1,5 +1,12 @@
 #pragma once
 
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/vector.h>
+
 namespace dealii
 {
   namespace VectorTools
@@ -495,5 +502,74 @@ namespace dealii
       vec_1.zero_out_ghost_values();
       vec_2.zero_out_ghost_values();
     }
+
+
+
+    /* Interpolate a function, which evaluates all its components at once via
+     * all_values(), into one vector per component in a single sweep over the
+     * cells. Components with nullptr vectors are skipped. The finite element
+     * has to be scalar and has to provide support points. Constraints are
+     * not applied.
+     */
+    template <int dim, typename FunctionType, typename VectorType>
+    void
+    interpolate_components(const Mapping<dim> &             mapping,
+                           const DoFHandler<dim> &          dof_handler,
+                           const FunctionType &             function,
+                           const std::vector<VectorType *> &vectors)
+    {
+      const auto &fe = dof_handler.get_fe();
+
+      AssertDimension(fe.n_components(), 1);
+      Assert(fe.has_support_points(), ExcNotImplemented());
+
+      const auto vector_0 =
+        std::find_if(vectors.begin(), vectors.end(), [](const auto &vector) {
+          return vector != nullptr;
+        });
+
+      if (vector_0 == vectors.end())
+        return;
+
+      const auto &partitioner = *(*vector_0)->get_partitioner();
+
+      FEValues<dim> fe_values(mapping,
+                              fe,
+                              Quadrature<dim>(fe.get_unit_support_points()),
+                              update_quadrature_points);
+
+      std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+      Vector<double>                       values(vectors.size());
+
+      // Each locally owned DoF is evaluated only once
+      std::vector<bool> is_evaluated(partitioner.locally_owned_size(), false);
+
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (cell->is_locally_owned())
+          {
+            fe_values.reinit(cell);
+            cell->get_dof_indices(dof_indices);
+
+            for (unsigned int i = 0; i < dof_indices.size(); ++i)
+              {
+                if (partitioner.in_local_range(dof_indices[i]) == false)
+                  continue;
+
+                const unsigned int local_index =
+                  partitioner.global_to_local(dof_indices[i]);
+
+                if (is_evaluated[local_index])
+                  continue;
+
+                is_evaluated[local_index] = true;
+
+                function.all_values(fe_values.quadrature_point(i), values);
+
+                for (unsigned int c = 0; c < vectors.size(); ++c)
+                  if (vectors[c] != nullptr)
+                    vectors[c]->local_element(local_index) = values[c];
+              }
+          }
+    }
   } // namespace VectorTools
 } // namespace dealii
\ No newline at end of file
@@ -8,12 +8,20 @@ namespace TimeIntegration
 {
   using namespace dealii;
 
+  /* Solutions of the current and of the old time steps. The old solutions
+   * are kept in a ring buffer: committing a time step only rotates the
+   * pointers. Between commit_old_solutions() and set_recent_old_solution(),
+   * the recent old solution shares its vector with the next older one, the
+   * vector of the oldest solution is kept as storage for the next recent old
+   * solution.
+   */
   template <typename VectorType>
   class SolutionHistory
   {
   public:
     SolutionHistory(unsigned int size)
       : solutions(size)
+      , n_modifications(std::make_shared<unsigned int>(0))
     {
       for (unsigned int i = 0; i < solutions.size(); ++i)
         solutions[i] = std::make_shared<VectorType>();
@@ -21,22 +29,29 @@ namespace TimeIntegration
 
     SolutionHistory(std::vector<std::shared_ptr<VectorType>> solutions)
       : solutions(solutions)
+      , n_modifications(std::make_shared<unsigned int>(0))
     {}
 
     void
     apply(std::function<void(VectorType &)> f) const
     {
+      register_modification();
+
       for (unsigned int i = 0; i < solutions.size(); ++i)
-        f(*solutions[i]);
+        if (!is_shared(i))
+          f(*solutions[i]);
     }
 
     void
     apply_blockwise(
       std::function<void(typename VectorType::BlockType &)> f) const
     {
+      register_modification();
+
       for (unsigned int i = 0; i < solutions.size(); ++i)
-        for (unsigned int b = 0; b < solutions[i]->n_blocks(); ++b)
-          f(solutions[i]->block(b));
+        if (!is_shared(i))
+          for (unsigned int b = 0; b < solutions[i]->n_blocks(); ++b)
+            f(solutions[i]->block(b));
     }
 
     unsigned int
@@ -60,7 +75,11 @@ namespace TimeIntegration
         if (can_process(i, keep_current, keep_recent, keep_old))
           subset.push_back(solutions[i]);
 
-      return SolutionHistory(subset);
+      // modifications via the subset are visible to this history
+      SolutionHistory<VectorType> result(subset);
+      result.n_modifications = n_modifications;
+
+      return result;
     }
 
     void
@@ -96,6 +115,9 @@ namespace TimeIntegration
     std::vector<std::shared_ptr<typename VectorType::BlockType>>
     get_all_blocks() const
     {
+      // the blocks can be modified by the caller
+      register_modification();
+
       std::vector<std::shared_ptr<typename VectorType::BlockType>> solution_ptr;
 
       for (unsigned int i = 0; i < solutions.size(); ++i)
@@ -108,6 +130,9 @@ namespace TimeIntegration
     std::vector<typename VectorType::BlockType *>
     get_all_blocks_raw() const
     {
+      // the blocks can be modified by the caller
+      register_modification();
+
       std::vector<typename VectorType::BlockType *> solution_ptr;
 
       for (unsigned int i = 0; i < solutions.size(); ++i)
@@ -120,12 +145,23 @@ namespace TimeIntegration
     void
     commit_old_solutions() const
     {
-      for (int i = solutions.size() - 2; i >= 1; --i)
-        {
-          solutions[i]->zero_out_ghost_values();
-          *solutions[i + 1] = *solutions[i];
-          solutions[i + 1]->update_ghost_values();
-        }
+      register_modification();
+
+      if (solutions.size() <= 2)
+        return;
+
+      // the oldest solution is dropped, its vector is recycled later on
+      if (!is_shared(1))
+        spare_solution = solutions.back();
+
+      for (unsigned int i = solutions.size() - 1; i >= 2; --i)
+        solutions[i] = solutions[i - 1];
+
+      // old solutions keep their ghost values, since they do not change
+      // anymore
+      for (unsigned int i = 2; i < solutions.size(); ++i)
+        if (!solutions[i]->has_ghost_elements())
+          solutions[i]->update_ghost_values();
     }
 
     void
@@ -133,8 +169,34 @@ namespace TimeIntegration
     {
       Assert(src.has_ghost_elements() == false, ExcInternalError());
 
-      *solutions[1] = src;
-      solutions[1]->update_ghost_values();
+      register_modification();
+
+      if (is_shared(1))
+        {
+          solutions[1] = spare_solution ? spare_solution :
+                                          std::make_shared<VectorType>();
+          spare_solution.reset();
+        }
+
+      auto &dst = *solutions[1];
+
+      // avoid the reinitialization of the blocks if the layout matches
+      bool is_compatible = dst.n_blocks() == src.n_blocks();
+      for (unsigned int b = 0; is_compatible && b < src.n_blocks(); ++b)
+        is_compatible = dst.block(b).get_partitioner().get() ==
+                        src.block(b).get_partitioner().get();
+
+      if (is_compatible)
+        {
+          dst.zero_out_ghost_values();
+          dst.copy_locally_owned_data_from(src);
+        }
+      else
+        {
+          dst = src;
+        }
+
+      dst.update_ghost_values();
     }
 
     const VectorType &
@@ -154,13 +216,86 @@ namespace TimeIntegration
     VectorType &
     get_current_solution()
     {
+      register_modification();
+
       solutions[0]->zero_out_ghost_values();
       return *solutions[0];
     }
 
+    /* Enable the caching of the weighted sum of the old solutions, see
+     * get_precombined_old_solutions(). */
+    void
+    set_precombine_old_solutions(const bool flag)
+    {
+      precombine_old_solutions = flag;
+      precombined_old_solutions.reset();
+    }
+
+    bool
+    use_precombined_old_solutions() const
+    {
+      return precombine_old_solutions;
+    }
+
+    /* Return the sum of the old solutions weighted by the BDF weights, the
+     * old solution i being multiplied by weights[i + 1]. The sum is computed
+     * once and reused until the old solutions or the weights change, i.e.,
+     * typically once per time step.
+     */
+    template <typename Number>
+    const VectorType &
+    get_precombined_old_solutions(const std::vector<Number> &weights) const
+    {
+      AssertIndexRange(weights.size(), solutions.size() + 1);
+
+      const unsigned int n_old = weights.size() - 1;
+
+      bool is_valid =
+        precombined_old_solutions &&
+        precombined_n_modifications == *n_modifications &&
+        precombined_weights.size() == n_old &&
+        precombined_old_solutions->n_blocks() == solutions[1]->n_blocks();
+
+      for (unsigned int i = 0; is_valid && i < n_old; ++i)
+        is_valid = precombined_weights[i] == weights[i + 1];
+
+      // the old solutions might have been reinitialized after AMR
+      for (unsigned int b = 0;
+           is_valid && b < precombined_old_solutions->n_blocks();
+           ++b)
+        is_valid = precombined_old_solutions->block(b).get_partitioner() ==
+                   solutions[1]->block(b).get_partitioner();
+
+      if (is_valid)
+        return *precombined_old_solutions;
+
+      if (!precombined_old_solutions)
+        precombined_old_solutions = std::make_shared<VectorType>();
+
+      auto &dst = *precombined_old_solutions;
+
+      dst.reinit(*solutions[1], true);
+      dst.zero_out_ghost_values();
+      dst.copy_locally_owned_data_from(*solutions[1]);
+      dst *= weights[1];
+
+      for (unsigned int i = 1; i < n_old; ++i)
+        dst.add(weights[i + 1], *solutions[i + 1]);
+
+      dst.update_ghost_values();
+
+      precombined_weights.assign(weights.begin() + 1, weights.end());
+      precombined_n_modifications = *n_modifications;
+
+      return dst;
+    }
+
     std::vector<std::shared_ptr<VectorType>>
     get_old_solutions() const
     {
+      // the solutions can be modified by the caller
+      register_modification();
+
       return std::vector<std::shared_ptr<VectorType>>(solutions.begin() + 1,
                                                       solutions.end());
     }
@@ -168,13 +303,17 @@ namespace TimeIntegration
     std::vector<std::shared_ptr<VectorType>>
     get_all_solutions() const
     {
+      // the solutions can be modified by the caller
+      register_modification();
+
       return solutions;
     }
 
     virtual std::size_t
     memory_consumption() const
     {
-      return MyMemoryConsumption::memory_consumption(solutions);
+      return MyMemoryConsumption::memory_consumption(solutions) +
+             (spare_solution ? spare_solution->memory_consumption() : 0);
     }
 
     void
@@ -186,6 +325,15 @@ namespace TimeIntegration
     }
 
   private:
+    /* Invalidate the weighted sum of the old solutions. This is done by
+     * all functions that modify the solutions or give mutable access to
+     * them. */
+    void
+    register_modification() const
+    {
+      ++(*n_modifications);
+    }
+
     bool
     can_process(const unsigned int index,
                 const bool         keep_current,
@@ -196,6 +344,25 @@ namespace TimeIntegration
              (index > 1 && keep_old);
     }
 
-    std::vector<std::shared_ptr<VectorType>> solutions;
+    /* Check if the vector of the given solution is shared with the next
+     * older solution. */
+    bool
+    is_shared(const unsigned int index) const
+    {
+      return index + 1 < solutions.size() &&
+             solutions[index] == solutions[index + 1];
+    }
+
+    mutable std::vector<std::shared_ptr<VectorType>> solutions;
+    mutable std::shared_ptr<VectorType>              spare_solution;
+
+    // counter of the modifications of the solutions, shared with the
+    // histories created by filter()
+    std::shared_ptr<unsigned int> n_modifications;
+
+    bool                                precombine_old_solutions = false;
+    mutable std::shared_ptr<VectorType> precombined_old_solutions;
+    mutable std::vector<double>         precombined_weights;
+    mutable unsigned int                precombined_n_modifications = 0;
   };
 } // namespace TimeIntegration
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <deal.II/base/mpi.h>
+
+#include <pf-applications/grain_tracker/distributed_stitching.h>
+
+using namespace dealii;
+
+// Stitching of particles that span all processes: the first particle of each
+// process forms a chain through all processes, the second one is connected
+// to the processes two ranks apart and the third one is isolated. Can be run
+// with an arbitrary number of processes.
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_init(argc, argv, 1);
+
+  const MPI_Comm     comm    = MPI_COMM_WORLD;
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  const unsigned int n_local_particles = 3;
+
+  const auto global_id = [&](const unsigned int rank, const unsigned int i) {
+    return rank * n_local_particles + i;
+  };
+
+  std::vector<std::vector<std::tuple<unsigned int, unsigned int>>> input(
+    n_local_particles);
+
+  // chain through all processes
+  if (my_rank > 0)
+    input[0].emplace_back(my_rank - 1, global_id(my_rank - 1, 0));
+  if (my_rank + 1 < n_procs)
+    input[0].emplace_back(my_rank + 1, global_id(my_rank + 1, 0));
+
+  // periodic connection to the processes two ranks apart
+  for (const unsigned int other_rank :
+       {(my_rank + 2) % n_procs, (my_rank + n_procs - 2) % n_procs})
+    if (other_rank != my_rank)
+      input[1].emplace_back(other_rank, global_id(other_rank, 1));
+
+  for (auto &input_i : input)
+    {
+      std::sort(input_i.begin(), input_i.end());
+      input_i.erase(std::unique(input_i.begin(), input_i.end()),
+                    input_i.end());
+    }
+
+  unsigned int n_rounds = 0;
+
+  const auto result = GrainTracker::perform_distributed_stitching(comm,
+                                                                  input,
+                                                                  nullptr,
+                                                                  &n_rounds);
+
+  const auto results = Utilities::MPI::gather(comm, result, 0);
+
+  if (my_rank == 0)
+    {
+      for (const auto &result : results)
+        {
+          for (const auto i : result)
+            std::cout << i << " ";
+          std::cout << std::endl;
+        }
+
+      // the chain spans all processes, so the number of union-find rounds
+      // grows with the logarithm of the number of processes
+      std::cout << "n_rounds = " << n_rounds << std::endl;
+    }
+}
@@ -0,0 +1,110 @@
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
+#include <pf-applications/lac/dynamic_block_vector.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace dealii;
+
+// Compare the fused ghost exchange and reductions of DynamicBlockVector with
+// the block-wise ones. Each process owns 10 entries and has the first 3
+// entries of the next process and the last 2 entries of the previous process
+// as ghosts.
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_init(argc, argv, 1);
+
+  using VectorType = LinearAlgebra::distributed::DynamicBlockVector<double>;
+
+  const MPI_Comm     comm    = MPI_COMM_WORLD;
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  const unsigned int n_local  = 10;
+  const unsigned int n_global = n_local * n_procs;
+  const unsigned int n_blocks = 3;
+
+  IndexSet locally_owned(n_global);
+  locally_owned.add_range(my_rank * n_local, (my_rank + 1) * n_local);
+
+  IndexSet ghosts(n_global);
+  const unsigned int next = ((my_rank + 1) % n_procs) * n_local;
+  const unsigned int prev = ((my_rank + n_procs - 1) % n_procs) * n_local;
+  ghosts.add_range(next, next + 3);
+  ghosts.add_range(prev + n_local - 2, prev + n_local);
+  ghosts.subtract_set(locally_owned);
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned, ghosts, comm);
+
+  const auto value = [](const unsigned int b, const unsigned int i) {
+    return 1000.0 * (b + 1) + i;
+  };
+
+  VectorType vec(n_blocks);
+  for (unsigned int b = 0; b < n_blocks; ++b)
+    {
+      vec.block(b).reinit(partitioner);
+      for (const auto i : locally_owned)
+        vec.block(b)[i] = value(b, i);
+    }
+
+  VectorType other(vec);
+  other *= 0.5;
+
+  const auto check_ghosts = [&](const std::string &label) {
+    bool success = true;
+    for (unsigned int b = 0; b < n_blocks; ++b)
+      for (const auto i : ghosts)
+        success &= (vec.block(b)[i] == value(b, i));
+
+    success = Utilities::MPI::min(static_cast<unsigned int>(success), comm);
+
+    if (my_rank == 0)
+      std::cout << label << ": " << (success ? "OK" : "FAILED") << std::endl;
+
+    vec.zero_out_ghost_values();
+  };
+
+  const auto print_reductions = [&](const std::string &label) {
+    if (my_rank == 0)
+      std::cout << label << ": " << std::setprecision(10) << vec.l1_norm()
+                << " " << vec.l2_norm() << " " << vec.linfty_norm() << " "
+                << vec * other << std::endl;
+  };
+
+  for (const bool fused : {false, true})
+    {
+      vec.set_fused_communication(fused);
+
+      const std::string label = fused ? "fused" : "block-wise";
+
+      vec.update_ghost_values();
+      check_ghosts(label + " ghost values");
+
+      print_reductions(label + " reductions");
+    }
+
+  // views and moved blocks share the partitioner and use the fused path
+  vec.set_fused_communication(true);
+
+  vec.move_block(0, 2);
+  vec.move_block(2, 0);
+
+  const auto view = vec.create_view(1, n_blocks);
+  view->update_ghost_values();
+
+  bool success = true;
+  for (unsigned int b = 1; b < n_blocks; ++b)
+    for (const auto i : ghosts)
+      success &= (vec.block(b)[i] == value(b, i));
+  success = Utilities::MPI::min(static_cast<unsigned int>(success), comm);
+
+  if (my_rank == 0)
+    std::cout << "view ghost values: " << (success ? "OK" : "FAILED")
+              << std::endl;
+}
@@ -0,0 +1,177 @@
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include <pf-applications/lac/dynamic_block_vector.h>
+#include <pf-applications/lac/solvers_linear.h>
+
+#include <iostream>
+
+using namespace dealii;
+
+// Solve a sequence of shifted 1D Laplacians (2 + s) u_i - u_{i-1} - u_{i+1}
+// with slightly increasing shifts with SolverGCRODRWrapper and with
+// SolverGMRES. The recycled subspace is kept between the solves and reduces
+// the number of iterations. Finally, the number of blocks is changed, which
+// discards the recycled subspace: the solver then needs as many iterations
+// as a new one.
+template <typename Number>
+class ShiftedLaplaceOperator
+{
+public:
+  using value_type      = Number;
+  using vector_type     = LinearAlgebra::distributed::Vector<Number>;
+  using BlockVectorType =
+    LinearAlgebra::distributed::DynamicBlockVector<Number>;
+
+  ShiftedLaplaceOperator(const double shift)
+    : shift(shift)
+  {}
+
+  void
+  set_shift(const double shift)
+  {
+    this->shift = shift;
+  }
+
+  void
+  vmult(vector_type &dst, const vector_type &src) const
+  {
+    const unsigned int n = src.size();
+
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        dst[i] = (2.0 + shift) * src[i];
+        if (i > 0)
+          dst[i] -= src[i - 1];
+        if (i + 1 < n)
+          dst[i] -= src[i + 1];
+      }
+  }
+
+  void
+  vmult(BlockVectorType &dst, const BlockVectorType &src) const
+  {
+    for (unsigned int b = 0; b < src.n_blocks(); ++b)
+      vmult(dst.block(b), src.block(b));
+  }
+
+private:
+  double shift;
+};
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_init(argc, argv, 1);
+
+  using Number          = double;
+  using Operator        = ShiftedLaplaceOperator<Number>;
+  using BlockVectorType = Operator::BlockVectorType;
+  using Solver =
+    LinearSolvers::SolverGCRODRWrapper<Operator, PreconditionIdentity>;
+
+  const unsigned int n = 100;
+  const double       h = 1.0 / (n + 1);
+
+  // the recycled subspace is only kept for vectors with the same partitioner
+  const auto partitioner = std::make_shared<Utilities::MPI::Partitioner>(n);
+
+  const auto initialize_exact = [&](BlockVectorType &  exact,
+                                    const unsigned int n_blocks) {
+    exact.reinit(n_blocks);
+    for (unsigned int b = 0; b < n_blocks; ++b)
+      {
+        exact.block(b).reinit(partitioner);
+        for (unsigned int i = 0; i < n; ++i)
+          {
+            const double x    = (i + 1) * h;
+            exact.block(b)[i] = x * (1.0 - x);
+          }
+      }
+  };
+
+  PreconditionIdentity preconditioner;
+
+  Operator op(0.05);
+
+  // solve the system of the current shift, the exact solution is the parabola
+  // x (1 - x) in each block
+  const auto solve = [&](auto &                 solver,
+                         SolverControl &        control,
+                         const BlockVectorType &exact) {
+    BlockVectorType rhs(exact);
+    op.vmult(rhs, exact);
+
+    BlockVectorType solution(exact);
+    solution = 0.0;
+
+    control.set_tolerance(1e-10 * rhs.l2_norm());
+    solver.solve(solution, rhs);
+
+    solution.add(-1.0, exact);
+    AssertThrow(solution.linfty_norm() < 1e-9, ExcMessage("Wrong solution"));
+
+    return control.last_step();
+  };
+
+  SolverControl control(1000, 1e-10);
+  Solver        solver(op, preconditioner, control);
+
+  SolverControl                control_gmres(1000, 1e-10);
+  SolverGMRES<BlockVectorType> solver_gmres(control_gmres);
+
+  const auto solve_gmres = [&](const BlockVectorType &exact) {
+    BlockVectorType rhs(exact);
+    op.vmult(rhs, exact);
+
+    BlockVectorType solution(exact);
+    solution = 0.0;
+
+    control_gmres.set_tolerance(1e-10 * rhs.l2_norm());
+    solver_gmres.solve(op, solution, rhs, preconditioner);
+
+    return control_gmres.last_step();
+  };
+
+  BlockVectorType exact;
+  initialize_exact(exact, 1);
+
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      op.set_shift(0.05 * (1.0 + 0.01 * i));
+
+      const unsigned int n_iterations       = solve(solver, control, exact);
+      const unsigned int n_iterations_gmres = solve_gmres(exact);
+
+      std::cout << "system " << i << ":" << std::endl;
+      std::cout << "  recycled vectors: " << solver.n_recycled_vectors()
+                << std::endl;
+      std::cout << "  fewer iterations than SolverGMRES: "
+                << (n_iterations < n_iterations_gmres ? "OK" : "FAILED")
+                << std::endl;
+    }
+
+  // the recycled subspace of a single block does not fit two blocks
+  op.set_shift(0.052);
+
+  initialize_exact(exact, 2);
+
+  const unsigned int n_iterations = solve(solver, control, exact);
+
+  SolverControl control_new(1000, 1e-10);
+  Solver        solver_new(op, preconditioner, control_new);
+
+  const unsigned int n_iterations_new = solve(solver_new, control_new, exact);
+
+  std::cout << "two blocks:" << std::endl;
+  std::cout << "  recycled vectors: " << solver.n_recycled_vectors()
+            << std::endl;
+  std::cout << "  same iterations as a new solver: "
+            << (n_iterations == n_iterations_new ? "OK" : "FAILED")
+            << std::endl;
+}
@@ -0,0 +1,79 @@
+#include <deal.II/base/exceptions.h>
+
+#include <pf-applications/sintering/particle_cloud.h>
+
+#include <iostream>
+
+using namespace dealii;
+
+// Write a particle cloud with contacts and colors to a binary file and read
+// it back. Clouds whose colors are not numbered contiguously or whose
+// particles in contact share a color are rejected when read.
+int
+main()
+{
+  constexpr int dim = 2;
+
+  const std::string file_name = "particle_cloud_01.bin";
+
+  // a chain of three particles and an isolated one
+  Sintering::ParticleCloud<dim> cloud;
+  cloud.particles = {{Point<dim>(0.0, 0.0), 1.0, 0, {}},
+                     {Point<dim>(1.5, 0.0), 1.0, 1, {}},
+                     {Point<dim>(3.0, 0.0), 1.0, 2, {}},
+                     {Point<dim>(0.0, 5.0), 0.5, 3, {}}};
+  cloud.has_contacts           = true;
+  cloud.contacts               = {{0, 1}, {1, 2}};
+  cloud.colors                 = {0, 1, 0, 1};
+  cloud.interface_width        = 0.1;
+  cloud.interface_buffer_ratio = 0.5;
+
+  Sintering::write_binary_cloud(file_name, cloud);
+
+  std::cout << "binary: " << Sintering::is_binary_cloud(file_name)
+            << std::endl;
+
+  const auto cloud_read = Sintering::read_particle_cloud<dim>(file_name);
+
+  for (const auto &particle : cloud_read.particles)
+    std::cout << "particle " << particle.id << ": center = " << particle.center
+              << ", radius = " << particle.radius << std::endl;
+
+  std::cout << "contacts (" << cloud_read.has_contacts << "):";
+  for (const auto &[i, j] : cloud_read.contacts)
+    std::cout << " " << i << "-" << j;
+  std::cout << std::endl;
+
+  std::cout << "colors:";
+  for (const auto color : cloud_read.colors)
+    std::cout << " " << color;
+  std::cout << std::endl;
+
+  std::cout << "colors valid for the interface: "
+            << cloud_read.has_colors_for(0.1, 0.5) << " "
+            << cloud_read.has_colors_for(0.2, 0.5) << std::endl;
+
+  const auto check_rejected = [&](const std::string &              label,
+                                  const std::vector<unsigned int> &colors) {
+    auto cloud_invalid   = cloud;
+    cloud_invalid.colors = colors;
+
+    Sintering::write_binary_cloud(file_name, cloud_invalid);
+
+    bool rejected = false;
+    try
+      {
+        Sintering::read_binary_cloud<dim>(file_name);
+      }
+    catch (const ExceptionBase &)
+      {
+        rejected = true;
+      }
+
+    std::cout << label << ": " << (rejected ? "rejected" : "accepted")
+              << std::endl;
+  };
+
+  check_rejected("particles 0 and 1 share a color", {0, 0, 1, 1});
+  check_rejected("color 1 is not used", {0, 2, 0, 2});
+}
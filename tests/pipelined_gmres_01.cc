@@ -0,0 +1,146 @@
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
+
+#include <pf-applications/lac/dynamic_block_vector.h>
+#include <pf-applications/lac/solvers_linear.h>
+
+#include <cmath>
+#include <iostream>
+
+using namespace dealii;
+
+// Compare SolverPipelinedGMRESWrapper with SolverGMRES for the shifted 1D
+// Laplacian (2 + s) u_i - u_{i-1} - u_{i+1}. The right-hand side of the first
+// system is computed from the parabola x (1 - x), which is recovered after
+// several restarts. The right-hand side of the second system is an
+// eigenvector, so that both solvers stop after a single iteration due to a
+// lucky breakdown.
+template <typename Number>
+class ShiftedLaplaceOperator
+{
+public:
+  using value_type      = Number;
+  using vector_type     = LinearAlgebra::distributed::Vector<Number>;
+  using BlockVectorType =
+    LinearAlgebra::distributed::DynamicBlockVector<Number>;
+
+  ShiftedLaplaceOperator(const double shift)
+    : shift(shift)
+  {}
+
+  void
+  vmult(vector_type &dst, const vector_type &src) const
+  {
+    const unsigned int n = src.size();
+
+    for (unsigned int i = 0; i < n; ++i)
+      {
+        dst[i] = (2.0 + shift) * src[i];
+        if (i > 0)
+          dst[i] -= src[i - 1];
+        if (i + 1 < n)
+          dst[i] -= src[i + 1];
+      }
+  }
+
+  void
+  vmult(BlockVectorType &dst, const BlockVectorType &src) const
+  {
+    for (unsigned int b = 0; b < src.n_blocks(); ++b)
+      vmult(dst.block(b), src.block(b));
+  }
+
+private:
+  const double shift;
+};
+
+template <typename Operator, typename VectorType>
+void
+test(const std::string &label,
+     const Operator &   op,
+     const VectorType & rhs,
+     const VectorType & exact)
+{
+  PreconditionIdentity preconditioner;
+
+  const double tolerance = 1e-10 * rhs.l2_norm();
+
+  VectorType reference(rhs);
+  reference = 0.0;
+
+  SolverControl           control_reference(1000, tolerance);
+  SolverGMRES<VectorType> solver_reference(control_reference);
+  solver_reference.solve(op, reference, rhs, preconditioner);
+
+  VectorType solution(rhs);
+  solution = 0.0;
+
+  SolverControl control(1000, tolerance);
+  LinearSolvers::SolverPipelinedGMRESWrapper<Operator, PreconditionIdentity>
+    solver(op, preconditioner, control);
+
+  const unsigned int n_iterations = solver.solve(solution, rhs);
+
+  VectorType difference(solution);
+  difference.add(-1.0, reference);
+
+  std::cout << label << ":" << std::endl;
+  std::cout << "  SolverGMRES:          " << control_reference.last_step()
+            << " iterations" << std::endl;
+  std::cout << "  SolverPipelinedGMRES: " << n_iterations << " iterations"
+            << std::endl;
+  std::cout << "  difference to SolverGMRES: "
+            << (difference.linfty_norm() < 1e-12 ? "OK" : "FAILED")
+            << std::endl;
+
+  VectorType error(solution);
+  error.add(-1.0, exact);
+
+  std::cout << "  error: " << (error.linfty_norm() < 1e-9 ? "OK" : "FAILED")
+            << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_init(argc, argv, 1);
+
+  using Number          = double;
+  using Operator        = ShiftedLaplaceOperator<Number>;
+  using BlockVectorType = Operator::BlockVectorType;
+
+  const unsigned int n     = 100;
+  const double       h     = 1.0 / (n + 1);
+  const double       shift = 0.05;
+
+  const Operator op(shift);
+
+  BlockVectorType exact(1), rhs(1);
+  exact.block(0).reinit(n);
+  rhs.block(0).reinit(n);
+
+  // more than the 28 basis vectors of a cycle are needed
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      const double x    = (i + 1) * h;
+      exact.block(0)[i] = x * (1.0 - x);
+    }
+  op.vmult(rhs, exact);
+
+  test("parabola (restarted)", op, rhs, exact);
+
+  // the Krylov space of an eigenvector is invariant
+  const double lambda = 2.0 + shift - 2.0 * std::cos(numbers::PI * h);
+
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      rhs.block(0)[i]   = std::sin(numbers::PI * (i + 1) * h);
+      exact.block(0)[i] = rhs.block(0)[i] / lambda;
+    }
+
+  test("eigenvector (lucky breakdown)", op, rhs, exact);
+}